@@ -1,6 +1,11 @@
 @echo off
 setlocal enabledelayedexpansion
 
+:: Set GLAD_HOOKS=1 to hook raylib's glad loader for exact draw counts and GPU pass timers.
+:: Only links against the static raylib.lib, not raylibdll.lib
+set GLAD_FLAGS=
+if "%GLAD_HOOKS%"=="1" set GLAD_FLAGS=/DUSE_GLAD_HOOKS
+
 :: If no arguments provided, default to build
 if "%~1"=="" goto :build
 
@@ -8,9 +13,11 @@ if "%~1"=="" goto :build
 if "%~1"=="build" goto :build
 if "%~1"=="run" goto :run
 if "%~1"=="MSbuild" goto :msbuild
+if "%~1"=="bench" goto :bench
+if "%~1"=="sim" goto :sim
 
 echo Unknown command: %~1
-echo Usage: build.bat [build^|run]
+echo Usage: build.bat [build^|run^|bench^|sim]
 exit /b 1
 
 :msbuild
@@ -23,6 +30,38 @@ if errorlevel 1 (
 ".\projects\VS2022\build\raylib_game\bin\x64\Debug\raylib_game.exe"
 goto :eof
 
+:bench
+echo ---------------------------------
+echo Building and running render bench
+echo ---------------------------------
+
+cl src/render_bench.c /I"../raylib-5.0_win64_msvc16/include/" /MD /O2 /DPLATFORM_DESKTOP /DUSE_GLAD_HOOKS /link /MACHINE:X64 /OUT:"src\render_bench.exe" "../raylib-5.0_win64_msvc16/lib/raylib.lib" opengl32.lib kernel32.lib user32.lib shell32.lib gdi32.lib winmm.lib msvcrt.lib
+if errorlevel 1 (
+    echo Build failed
+    exit /b 1
+)
+
+pushd src
+.\render_bench.exe
+popd
+goto :eof
+
+:sim
+echo ----------------------------------
+echo Building and running balance sweep
+echo ----------------------------------
+
+cl src/balance_sim.c /I"../raylib-5.0_win64_msvc16/include/" /MD /O2 /link /MACHINE:X64 /OUT:"src\balance_sim.exe" "../raylib-5.0_win64_msvc16/lib/raylib.lib" opengl32.lib kernel32.lib user32.lib shell32.lib gdi32.lib winmm.lib msvcrt.lib
+if errorlevel 1 (
+    echo Build failed
+    exit /b 1
+)
+
+pushd src
+.\balance_sim.exe
+popd
+goto :eof
+
 :build
 echo ----------------------------
 echo Generating atlas header file
@@ -38,7 +77,7 @@ echo ---------------------------------
 echo Building and running using cl.exe
 echo ---------------------------------
 
-cl src/raylib_game.c /I"../raylib-5.0_win64_msvc16/include/" /MD /DEBUG /Zi /Od /link /DEBUG /MACHINE:X64 /OUT:"The_Apprentice.exe" "../raylib-5.0_win64_msvc16/lib/raylib.lib" opengl32.lib kernel32.lib user32.lib shell32.lib gdi32.lib winmm.lib msvcrt.lib
+cl src/raylib_game.c /I"../raylib-5.0_win64_msvc16/include/" /MD /DEBUG /Zi /Od %GLAD_FLAGS% /link /DEBUG /MACHINE:X64 /OUT:"The_Apprentice.exe" "../raylib-5.0_win64_msvc16/lib/raylib.lib" opengl32.lib kernel32.lib user32.lib shell32.lib gdi32.lib winmm.lib msvcrt.lib
 if errorlevel 1 (
     echo Build failed
     exit /b 1
@@ -61,7 +100,7 @@ echo ---------------------------------
 echo Building and running using cl.exe
 echo ---------------------------------
 
-cl src/raylib_game.c /I"../raylib-5.0_win64_msvc16/include/" /MD /DEBUG /Zi /Od /link /DEBUG /MACHINE:X64 /OUT:"src\The_Apprentice.exe" "../raylib-5.0_win64_msvc16/lib/raylib.lib" opengl32.lib kernel32.lib user32.lib shell32.lib gdi32.lib winmm.lib msvcrt.lib
+cl src/raylib_game.c /I"../raylib-5.0_win64_msvc16/include/" /MD /DEBUG /Zi /Od %GLAD_FLAGS% /link /DEBUG /MACHINE:X64 /OUT:"src\The_Apprentice.exe" "../raylib-5.0_win64_msvc16/lib/raylib.lib" opengl32.lib kernel32.lib user32.lib shell32.lib gdi32.lib winmm.lib msvcrt.lib
 if errorlevel 1 (
     echo Build failed
     exit /b 1
@@ -10,13 +10,14 @@
 ////////////////////////////////////////////////////////////////////////////////////////
 
 // Image data information
-#define ATLAS_WIDTH    144
-#define ATLAS_HEIGHT   176
-#define ATLAS_FORMAT   7          // raylib internal pixel format
+#define ATLAS_WIDTH    224
+#define ATLAS_HEIGHT   426
+#define ATLAS_FORMAT   1          // raylib internal pixel format
 
-static unsigned char ATLAS_DATA[101376] = { 0x0,
+static unsigned char ATLAS_DATA[95424] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -27,7 +28,9 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -36,7 +39,9 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -44,102 +49,170 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3,
+0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -147,6 +220,8 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -157,14 +232,9 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -188,12 +258,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -216,13 +280,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -245,13 +302,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -270,22 +320,21 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -293,27 +342,33 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -321,6 +376,10 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -328,49 +387,67 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -378,6 +455,10 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -385,23 +466,22 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -412,19 +492,13 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -447,13 +521,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -496,7 +563,2515 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x3, 0x4, 0x4,
+0x4, 0x3, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x2, 0x2, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8,
+0x8, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7,
+0x3, 0x8, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x8, 0x4, 0x4, 0x4,
+0x4, 0x8, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5,
+0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x7,
+0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x7, 0x8, 0x8,
+0x8, 0x7, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7,
+0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x6, 0x6,
+0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x8, 0x8, 0x8, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x1, 0x8, 0x8, 0x8,
+0x8, 0x1, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x1, 0x6, 0x1,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x1, 0x6, 0x2, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x5, 0x6, 0x6, 0x1, 0x1, 0x1,
+0x6, 0x2, 0x2, 0x8, 0x8, 0x2, 0x8, 0x8, 0x8, 0x2, 0x8, 0x6, 0x2, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x6, 0x5, 0x5, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x3, 0x4, 0x4, 0x4, 0x3, 0x4, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x6, 0x5, 0x5,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x5,
+0x5, 0x6, 0x2, 0x2, 0x6, 0x2, 0x2, 0x8, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x6, 0x5, 0x6, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x6, 0x6, 0x5, 0x5,
+0x6, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x7, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x6, 0x6,
+0x2, 0x2, 0x2, 0x6, 0x6, 0x2, 0x2, 0x2, 0x6, 0x6, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2,
+0x6, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x5, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x6,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x6, 0x5, 0x5, 0x5, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2, 0x5, 0x2, 0x2,
+0x2, 0x5, 0x2, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x5, 0x5, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8, 0x8, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x6, 0x6, 0x2, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x6,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x8, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x5, 0x6, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x3, 0x8, 0x3, 0x3,
+0x3, 0x8, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x5, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x6, 0x6, 0x2, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x2, 0x6, 0x6, 0x2, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2,
+0x2, 0x6, 0x5, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x7, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x6, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7,
+0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x1, 0x1, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x5, 0x6, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x6, 0x6, 0x2, 0x2, 0x2, 0x7, 0x7, 0x7, 0x7, 0x2, 0x2, 0x2, 0x6, 0x6, 0x2, 0x2,
+0x6, 0x5, 0x6, 0x2, 0x2, 0x2, 0x6, 0x5, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6,
+0x5, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x4, 0x4, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x6, 0x1, 0x1, 0x1, 0x6, 0x5, 0x6, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x2, 0x2, 0x6, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x6, 0x2, 0x2, 0x6, 0x3, 0x3, 0x3, 0x6, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x6, 0x7,
+0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+0x7, 0x7, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8,
+0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x6,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5,
+0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x4, 0x4, 0x3, 0x4, 0x4, 0x4, 0x3, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8, 0x8, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x3, 0x8, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x7, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6,
+0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x7, 0x7, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+0x7, 0x7, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x6, 0x6, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x4, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4,
+0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x4, 0x6, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x6, 0x6, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x5, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x6, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x8, 0x7, 0x7, 0x8, 0x7, 0x8, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5,
+0x5, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5,
+0x5, 0x5, 0x6, 0x3, 0x6, 0x1, 0x2, 0x8, 0x7, 0x7, 0x7, 0x8, 0x7, 0x7, 0x8, 0x4, 0x2, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x5, 0x5, 0x5, 0x6, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x6, 0x5, 0x5, 0x6, 0x4, 0x6, 0x2, 0x2, 0x4, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x4,
+0x2, 0x6, 0x4, 0x4, 0x6, 0x5, 0x5, 0x5, 0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4,
+0x4, 0x3, 0x4, 0x4, 0x4, 0x3, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x6, 0x5, 0x6, 0x6, 0x4, 0x2, 0x7, 0x8, 0x8, 0x7,
+0x8, 0x8, 0x7, 0x2, 0x6, 0x6, 0x5, 0x6, 0x5, 0x5, 0x5, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x7,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x2,
+0x7, 0x6, 0x8, 0x7, 0x8, 0x6, 0x7, 0x6, 0x6, 0x5, 0x6, 0x5, 0x5, 0x5, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x3, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x6, 0x1, 0x2, 0x5, 0x2, 0x2, 0x2, 0x5, 0x2, 0x6, 0x5, 0x5, 0x6, 0x5, 0x5, 0x6, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x8, 0x8, 0x8, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x2, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6,
+0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x7, 0x3, 0x8, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x2, 0x7, 0x4, 0x4, 0x4, 0x4, 0x4, 0x2, 0x6,
+0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7,
+0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x4, 0x4, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x1, 0x2, 0x7, 0x4, 0x6, 0x6,
+0x6, 0x4, 0x2, 0x2, 0x6, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x7,
+0x7, 0x4, 0x2, 0x2, 0x2, 0x4, 0x7, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x4, 0x4, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6,
+0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6,
+0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x5, 0x5, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x5, 0x5, 0x5, 0x6, 0x4,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x5, 0x5, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x6, 0x6, 0x5, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6,
+0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7,
+0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x7, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8,
+0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x5, 0x4, 0x8, 0x6, 0x3, 0x3, 0x4, 0x5, 0x4,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x3, 0x4, 0x4, 0x4, 0x3, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x8, 0x4, 0x5, 0x4, 0x6, 0x6,
+0x4, 0x5, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4,
+0x4, 0x3, 0x4, 0x4, 0x4, 0x3, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x7, 0x7, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x4, 0x5, 0x4, 0x4, 0x5, 0x4, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x8,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x4, 0x5, 0x5, 0x4, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x8, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x4, 0x5, 0x5, 0x4, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8,
+0x8, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x8, 0x8, 0x8, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x4, 0x5, 0x4, 0x4, 0x5, 0x4, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7,
+0x3, 0x8, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x3, 0x8, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x8, 0x4, 0x5, 0x4, 0x6, 0x6,
+0x4, 0x5, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7,
+0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x8, 0x8, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x5,
+0x4, 0x8, 0x6, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x7, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7,
+0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x4, 0x5, 0x4, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x7,
+0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6,
+0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x8, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x7, 0x7, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x7, 0x8, 0x8,
+0x8, 0x7, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x7, 0x7, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x6, 0x7, 0x7, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x4, 0x5, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6,
+0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7,
+0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3,
+0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3,
+0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x8, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x8, 0x8, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -534,11 +3109,7 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -562,12 +3133,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -591,79 +3156,156 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3,
+0x3, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0,
+0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0,
+0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0,
+0x3, 0x3, 0x3, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -674,22 +3316,18 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -706,15 +3344,14 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -722,36 +3359,55 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x6, 0x0, 0x0, 0x0, 0x6, 0x5, 0x7, 0x8, 0x8,
+0x8, 0x8, 0x5, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6,
+0x0, 0x6, 0x8, 0x8, 0x2, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2, 0x6, 0x0, 0x6, 0x5,
+0x5, 0x5, 0x7, 0x8, 0x8, 0x5, 0x7, 0x5, 0x8, 0x8, 0x5, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x7, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x2, 0x2, 0x2, 0x8, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2, 0x1,
+0x6, 0x0, 0x6, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x7, 0x8, 0x7, 0x8, 0x8, 0x7, 0x5, 0x8, 0x6, 0x0, 0x6,
+0x8, 0x8, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x1, 0x2, 0x1, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2,
+0x2, 0x2, 0x1, 0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x5, 0x7,
+0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x6, 0x0,
+0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x1, 0x8, 0x8, 0x8,
+0x8, 0x1, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x8,
+0x8, 0x5, 0x7, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x7, 0x7,
+0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x6,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -759,81 +3415,111 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x7, 0x5,
+0x5, 0x5, 0x7, 0x8, 0x8, 0x7, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x7,
+0x7, 0x7, 0x8, 0x7, 0x7, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6,
+0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8,
+0x8, 0x8, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x8, 0x8, 0x5, 0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x7, 0x8,
+0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x7, 0x7, 0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x8, 0x7, 0x8, 0x6, 0x0, 0x6,
+0x8, 0x7, 0x7, 0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x5, 0x8, 0x8, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x8,
+0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x7, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x8, 0x6, 0x0,
+0x6, 0x8, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x1, 0x2, 0x2, 0x2,
+0x1, 0x8, 0x8, 0x8, 0x2, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x5, 0x7, 0x8, 0x8, 0x8, 0x8, 0x7, 0x5,
+0x5, 0x5, 0x7, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x7, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7,
+0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x6,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x1,
+0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x8, 0x2, 0x2, 0x2, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x7, 0x8, 0x5, 0x8,
+0x8, 0x5, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8,
+0x8, 0x7, 0x7, 0x7, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x8,
+0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6,
+0x0, 0x6, 0x1, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x8, 0x8, 0x1, 0x2, 0x1, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8,
+0x8, 0x8, 0x7, 0x5, 0x8, 0x7, 0x8, 0x8, 0x7, 0x5, 0x5, 0x5, 0x7, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x7,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x2, 0x2, 0x2, 0x1, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x1, 0x8, 0x8, 0x8,
+0x6, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x5, 0x5, 0x5, 0x6, 0x0, 0x6,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x2, 0x1, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x5,
+0x6, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0,
+0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -850,110 +3536,168 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x8, 0x8, 0x8, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x6, 0x6, 0x1, 0x2, 0x2, 0x2, 0x2, 0x1, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x8, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x6, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x8, 0x7, 0x7, 0x8, 0x7, 0x8, 0x6, 0x6,
+0x6, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0x7, 0x7, 0x7,
+0x7, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x1, 0x8, 0x8, 0x8, 0x8, 0x1, 0x6, 0x6, 0x6,
+0x6, 0x0, 0x6, 0x6, 0x6, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x6,
+0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x0, 0x0, 0x0, 0x6, 0x1, 0x2, 0x8, 0x7, 0x7, 0x7, 0x8,
+0x7, 0x7, 0x8, 0x4, 0x2, 0x6, 0x0, 0x6, 0x6, 0x6, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x6,
+0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6, 0x0, 0x0, 0x6, 0x1, 0x6, 0x1, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x8, 0x1, 0x6, 0x2, 0x6, 0x0, 0x6, 0x2, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x2, 0x6,
+0x0, 0x0, 0x0, 0x6, 0x4, 0x4, 0x3, 0x4, 0x4, 0x4, 0x3, 0x4, 0x6, 0x0, 0x0, 0x0, 0x6, 0x2, 0x2, 0x4,
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x4, 0x2, 0x6, 0x0, 0x6, 0x2, 0x6, 0x8, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x8, 0x6, 0x2, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x6, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x6, 0x0, 0x0, 0x6, 0x2, 0x2, 0x8, 0x8,
+0x2, 0x8, 0x8, 0x8, 0x2, 0x8, 0x6, 0x2, 0x6, 0x0, 0x6, 0x2, 0x2, 0x2, 0x2, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x2, 0x2, 0x2, 0x6, 0x0, 0x0, 0x0, 0x6, 0x4, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x0, 0x0, 0x0,
+0x6, 0x6, 0x4, 0x2, 0x7, 0x8, 0x8, 0x7, 0x8, 0x8, 0x7, 0x2, 0x6, 0x6, 0x0, 0x6, 0x2, 0x2, 0x8, 0x2,
+0x2, 0x2, 0x2, 0x2, 0x2, 0x8, 0x2, 0x2, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x8, 0x6, 0x0, 0x0, 0x6,
+0x2, 0x2, 0x8, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x0, 0x6, 0x6, 0x2, 0x2, 0x2, 0x2,
+0x3, 0x5, 0x3, 0x2, 0x2, 0x2, 0x6, 0x6, 0x0, 0x0, 0x0, 0x6, 0x3, 0x3, 0x6, 0x3, 0x3, 0x3, 0x6, 0x3,
+0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x2, 0x7, 0x6, 0x8, 0x7, 0x8, 0x6, 0x7, 0x6, 0x6, 0x0, 0x0, 0x6,
+0x6, 0x2, 0x2, 0x2, 0x6, 0x6, 0x2, 0x6, 0x6, 0x2, 0x2, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x8, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x8, 0x7,
+0x6, 0x0, 0x0, 0x6, 0x6, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2, 0x2, 0x6, 0x2, 0x2, 0x6, 0x6, 0x0, 0x0, 0x6,
+0x6, 0x2, 0x2, 0x2, 0x3, 0x5, 0x3, 0x2, 0x2, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x3, 0x3, 0x6, 0x3,
+0x3, 0x3, 0x6, 0x3, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x1, 0x2, 0x5, 0x2, 0x2, 0x2, 0x5, 0x2, 0x6,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x7, 0x2, 0x2, 0x8, 0x8, 0x8, 0x2, 0x7, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x8, 0x3, 0x6, 0x6, 0x3,
+0x6, 0x6, 0x3, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x2, 0x2, 0x5, 0x2, 0x2, 0x2, 0x5, 0x2, 0x6, 0x0,
+0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x4, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6,
+0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x2, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x7, 0x7, 0x7, 0x2, 0x7, 0x7, 0x6, 0x6, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6,
+0x3, 0x3, 0x8, 0x8, 0x8, 0x3, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2,
+0x2, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x1, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x2, 0x2, 0x6, 0x6,
+0x0, 0x0, 0x6, 0x6, 0x7, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x7, 0x6, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x2,
+0x7, 0x4, 0x4, 0x4, 0x4, 0x4, 0x2, 0x6, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x8, 0x4, 0x7, 0x7, 0x7, 0x7,
+0x4, 0x8, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x6, 0x6, 0x6, 0x7, 0x3, 0x8, 0x3, 0x3, 0x3, 0x8, 0x7, 0x6, 0x6, 0x6, 0x0, 0x0, 0x6, 0x6, 0x2, 0x7,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x2, 0x6, 0x6, 0x0, 0x0, 0x6, 0x1, 0x2, 0x2, 0x4, 0x8, 0x8, 0x8, 0x8, 0x2,
+0x2, 0x2, 0x2, 0x6, 0x0, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x0,
+0x6, 0x6, 0x1, 0x2, 0x7, 0x4, 0x6, 0x6, 0x6, 0x4, 0x2, 0x2, 0x6, 0x6, 0x0, 0x6, 0x6, 0x2, 0x8, 0x4,
+0x8, 0x8, 0x8, 0x8, 0x4, 0x8, 0x2, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3, 0x3, 0x6, 0x0, 0x6,
+0x6, 0x2, 0x2, 0x2, 0x7, 0x7, 0x7, 0x7, 0x2, 0x2, 0x2, 0x6, 0x6, 0x0, 0x6, 0x1, 0x2, 0x2, 0x2, 0x7,
+0x7, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x0, 0x6, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+0x3, 0x3, 0x6, 0x0, 0x6, 0x4, 0x4, 0x7, 0x7, 0x4, 0x2, 0x2, 0x2, 0x4, 0x7, 0x4, 0x4, 0x6, 0x0, 0x6,
+0x2, 0x2, 0x8, 0x7, 0x4, 0x4, 0x4, 0x4, 0x7, 0x8, 0x2, 0x2, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x3, 0x3, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x3,
+0x3, 0x6, 0x0, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x4, 0x4, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0x0, 0x6, 0x2,
+0x2, 0x6, 0x2, 0x2, 0x7, 0x7, 0x2, 0x2, 0x6, 0x2, 0x2, 0x6, 0x0, 0x6, 0x3, 0x3, 0x6, 0x4, 0x4, 0x4,
+0x4, 0x4, 0x4, 0x6, 0x3, 0x3, 0x6, 0x0, 0x6, 0x4, 0x4, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x4,
+0x4, 0x6, 0x0, 0x6, 0x2, 0x2, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x2, 0x2, 0x6, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x6, 0x7, 0x8, 0x8, 0x8,
+0x8, 0x8, 0x6, 0x7, 0x7, 0x6, 0x0, 0x6, 0x2, 0x2, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x2, 0x2,
+0x6, 0x0, 0x6, 0x4, 0x4, 0x6, 0x7, 0x4, 0x4, 0x4, 0x4, 0x7, 0x6, 0x4, 0x4, 0x6, 0x0, 0x6, 0x6, 0x6,
+0x6, 0x7, 0x7, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x0, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0x6, 0x6,
+0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x0, 0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6, 0x6, 0x6,
+0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x6,
+0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x6, 0x7, 0x7, 0x6, 0x0, 0x6, 0x6, 0x6, 0x6, 0x7, 0x7, 0x6, 0x6, 0x7,
+0x7, 0x6, 0x6, 0x6, 0x6, 0x0, 0x6, 0x2, 0x2, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x2, 0x2, 0x6,
+0x0, 0x0, 0x0, 0x0, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+0x3, 0x3, 0x6, 0x6, 0x3, 0x3, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4,
+0x4, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x6, 0x6, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x4,
+0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x4,
+0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -964,20 +3708,20 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8, 0x8, 0x6, 0x6,
+0x6, 0x6, 0x8, 0x8, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x6, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x6,
+0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -986,6 +3730,9 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x8,
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x0, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -994,19 +3741,10 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x6, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x6, 0x0, 0x6, 0x6, 0x5, 0x5,
+0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1015,6 +3753,8 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7, 0x7, 0x6, 0x0,
+0x0, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1023,20 +3763,9 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x7,
+0x7, 0x6, 0x0, 0x0, 0x6, 0x6, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x6, 0x6, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1046,29 +3775,19 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x8, 0x8,
+0x8, 0x8, 0x7, 0x7, 0x6, 0x0, 0x0, 0x0, 0x6, 0x6, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6, 0x5, 0x5, 0x6, 0x6,
+0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x6, 0x7, 0x7, 0x8, 0x8, 0x7, 0x7, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1079,21 +3798,8 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x7, 0x7, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1103,29 +3809,18 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x7, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1138,19 +3833,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1167,19 +3849,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1196,18 +3865,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1224,19 +3881,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1253,19 +3897,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1282,19 +3913,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1311,19 +3929,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1339,20 +3944,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1369,18 +3960,7 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1657,8 +4237,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1685,10 +4263,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1714,10 +4288,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1743,9 +4313,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1772,9 +4339,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1800,10 +4364,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1829,10 +4389,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1858,23 +4414,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1886,23 +4425,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1915,23 +4437,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1944,23 +4449,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -1973,23 +4461,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2002,23 +4473,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2030,23 +4484,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2059,23 +4496,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2088,23 +4508,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2117,23 +4520,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2146,23 +4532,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2174,23 +4543,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2203,23 +4555,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2232,23 +4567,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2261,23 +4579,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2290,506 +4591,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2808,17 +4609,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2837,16 +4627,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2866,16 +4646,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2894,17 +4664,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2923,17 +4682,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2952,17 +4700,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -2981,16 +4718,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -3010,16 +4737,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -3038,17 +4755,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -3067,17 +4773,6 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
@@ -3091,1996 +4786,4 @@ static unsigned char ATLAS_DATA[101376] = { 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x2e, 0x29, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x49, 0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x8a, 0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x49,
-0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x8a,
-0x8e, 0x48, 0xff, 0x49, 0x54, 0x35, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x2e, 0x29, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0xde, 0xbf, 0x89, 0xff, 0xde,
-0xbf, 0x89, 0xff, 0xde, 0xbf, 0x89, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x5d,
-0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90, 0x7c, 0x68, 0xff, 0x90,
-0x7c, 0x68, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0xa4, 0x65, 0x3e, 0xff, 0xa4,
-0x65, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x5d, 0x45, 0x3e, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x24, 0x17, 0x1b, 0xff, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 };
+0x0, 0x0, 0x0 };
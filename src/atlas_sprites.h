@@ -0,0 +1,148 @@
+// Generated by gen_atlas.c, do not edit
+#ifndef ATLAS_SPRITES_H
+#define ATLAS_SPRITES_H
+
+typedef enum {
+    SPRITE_PLAYER,
+    SPRITE_APPRENTICE,
+    SPRITE_ENEMY_0,
+    SPRITE_ENEMY_1,
+    SPRITE_ENEMY_2,
+    SPRITE_ENEMY_3,
+    SPRITE_BLOOD,
+    SPRITE_ICON_NO_SPELL,
+    SPRITE_ICON_MANA_RAY,
+    SPRITE_ICON_DEATH_RAY,
+    SPRITE_ICON_NOT_FOLLOWING,
+    SPRITE_ICON_FOLLOWING,
+    SPRITE_ICON_SPELL_SELECTED,
+    SPRITE_HOWTO,
+    SPRITE_FONT,
+    SPRITE_COUNT,
+} Sprite_Id;
+
+// src: trimmed sprite in the atlas, offset: src position inside the untrimmed frame
+typedef struct Atlas_Sprite {
+    Rectangle src;
+    Vector2 offset;
+    Vector2 frame;
+} Atlas_Sprite;
+
+static const Atlas_Sprite ATLAS_SPRITES[SPRITE_COUNT] = {
+    [SPRITE_PLAYER] = { { 129, 314, 14, 15 }, { 1, 1 }, { 16, 16 } },
+    [SPRITE_APPRENTICE] = { { 174, 314, 14, 14 }, { 1, 2 }, { 16, 16 } },
+    [SPRITE_ENEMY_0] = { { 144, 314, 14, 15 }, { 1, 1 }, { 16, 16 } },
+    [SPRITE_ENEMY_1] = { { 189, 314, 14, 14 }, { 1, 2 }, { 16, 16 } },
+    [SPRITE_ENEMY_2] = { { 159, 314, 14, 15 }, { 1, 1 }, { 16, 16 } },
+    [SPRITE_ENEMY_3] = { { 204, 314, 14, 14 }, { 1, 2 }, { 16, 16 } },
+    [SPRITE_BLOOD] = { { 189, 329, 14, 7 }, { 1, 9 }, { 16, 16 } },
+    [SPRITE_ICON_NO_SPELL] = { { 129, 297, 16, 16 }, { 0, 0 }, { 16, 16 } },
+    [SPRITE_ICON_MANA_RAY] = { { 146, 297, 16, 16 }, { 0, 0 }, { 16, 16 } },
+    [SPRITE_ICON_DEATH_RAY] = { { 163, 297, 16, 16 }, { 0, 0 }, { 16, 16 } },
+    [SPRITE_ICON_NOT_FOLLOWING] = { { 180, 297, 16, 16 }, { 0, 0 }, { 16, 16 } },
+    [SPRITE_ICON_FOLLOWING] = { { 197, 297, 16, 16 }, { 0, 0 }, { 16, 16 } },
+    [SPRITE_ICON_SPELL_SELECTED] = { { 174, 329, 14, 11 }, { 1, 3 }, { 16, 16 } },
+    [SPRITE_HOWTO] = { { 0, 0, 208, 296 }, { 0, 15 }, { 208, 320 } },
+    [SPRITE_FONT] = { { 0, 297, 128, 128 }, { 0, 0 }, { 128, 128 } },
+};
+
+typedef enum {
+    CLIP_PLAYER_IDLE,
+    CLIP_PLAYER_WALK,
+    CLIP_PLAYER_CAST,
+    CLIP_APPRENTICE_IDLE,
+    CLIP_APPRENTICE_WALK,
+    CLIP_APPRENTICE_CAST,
+    CLIP_ENEMY_0_WALK,
+    CLIP_ENEMY_1_WALK,
+    CLIP_ENEMY_2_WALK,
+    CLIP_ENEMY_3_WALK,
+    CLIP_ENEMY_0_DEATH,
+    CLIP_ENEMY_1_DEATH,
+    CLIP_ENEMY_2_DEATH,
+    CLIP_ENEMY_3_DEATH,
+    CLIP_COUNT,
+} Clip_Id;
+
+// One keyframe: offset_y in source pixels, rotation in degrees, ticks at ANIM_TICK_RATE
+typedef struct Clip_Frame {
+    unsigned char sprite;
+    signed char offset_y;
+    signed char rotation;
+    unsigned char ticks;
+} Clip_Frame;
+
+// first: index of the clip's first keyframe in CLIP_FRAMES
+typedef struct Clip {
+    unsigned short first;
+    unsigned char count;
+    unsigned char loop;
+} Clip;
+
+static const Clip_Frame CLIP_FRAMES[46] = {
+    { SPRITE_PLAYER, 0, 0, 1 },
+    { SPRITE_PLAYER, 0, 0, 2 },
+    { SPRITE_PLAYER, -1, -4, 2 },
+    { SPRITE_PLAYER, 0, 0, 2 },
+    { SPRITE_PLAYER, -1, 4, 2 },
+    { SPRITE_PLAYER, 0, -6, 3 },
+    { SPRITE_PLAYER, -1, -6, 3 },
+    { SPRITE_APPRENTICE, 0, 0, 1 },
+    { SPRITE_APPRENTICE, 0, 0, 2 },
+    { SPRITE_APPRENTICE, -1, -4, 2 },
+    { SPRITE_APPRENTICE, 0, 0, 2 },
+    { SPRITE_APPRENTICE, -1, 4, 2 },
+    { SPRITE_APPRENTICE, 0, -6, 3 },
+    { SPRITE_APPRENTICE, -1, -6, 3 },
+    { SPRITE_ENEMY_0, 0, 0, 2 },
+    { SPRITE_ENEMY_0, -1, -4, 2 },
+    { SPRITE_ENEMY_0, 0, 0, 2 },
+    { SPRITE_ENEMY_0, -1, 4, 2 },
+    { SPRITE_ENEMY_1, 0, 0, 2 },
+    { SPRITE_ENEMY_1, -1, -4, 2 },
+    { SPRITE_ENEMY_1, 0, 0, 2 },
+    { SPRITE_ENEMY_1, -1, 4, 2 },
+    { SPRITE_ENEMY_2, 0, 0, 2 },
+    { SPRITE_ENEMY_2, -1, -4, 2 },
+    { SPRITE_ENEMY_2, 0, 0, 2 },
+    { SPRITE_ENEMY_2, -1, 4, 2 },
+    { SPRITE_ENEMY_3, 0, 0, 2 },
+    { SPRITE_ENEMY_3, -1, -4, 2 },
+    { SPRITE_ENEMY_3, 0, 0, 2 },
+    { SPRITE_ENEMY_3, -1, 4, 2 },
+    { SPRITE_ENEMY_0, -2, 20, 1 },
+    { SPRITE_ENEMY_0, -3, 45, 1 },
+    { SPRITE_ENEMY_0, -1, 70, 1 },
+    { SPRITE_ENEMY_0, 0, 90, 1 },
+    { SPRITE_ENEMY_1, -2, 20, 1 },
+    { SPRITE_ENEMY_1, -3, 45, 1 },
+    { SPRITE_ENEMY_1, -1, 70, 1 },
+    { SPRITE_ENEMY_1, 0, 90, 1 },
+    { SPRITE_ENEMY_2, -2, 20, 1 },
+    { SPRITE_ENEMY_2, -3, 45, 1 },
+    { SPRITE_ENEMY_2, -1, 70, 1 },
+    { SPRITE_ENEMY_2, 0, 90, 1 },
+    { SPRITE_ENEMY_3, -2, 20, 1 },
+    { SPRITE_ENEMY_3, -3, 45, 1 },
+    { SPRITE_ENEMY_3, -1, 70, 1 },
+    { SPRITE_ENEMY_3, 0, 90, 1 },
+};
+
+static const Clip CLIPS[CLIP_COUNT] = {
+    [CLIP_PLAYER_IDLE] = { 0, 1, 1 },
+    [CLIP_PLAYER_WALK] = { 1, 4, 1 },
+    [CLIP_PLAYER_CAST] = { 5, 2, 1 },
+    [CLIP_APPRENTICE_IDLE] = { 7, 1, 1 },
+    [CLIP_APPRENTICE_WALK] = { 8, 4, 1 },
+    [CLIP_APPRENTICE_CAST] = { 12, 2, 1 },
+    [CLIP_ENEMY_0_WALK] = { 14, 4, 1 },
+    [CLIP_ENEMY_1_WALK] = { 18, 4, 1 },
+    [CLIP_ENEMY_2_WALK] = { 22, 4, 1 },
+    [CLIP_ENEMY_3_WALK] = { 26, 4, 1 },
+    [CLIP_ENEMY_0_DEATH] = { 30, 4, 0 },
+    [CLIP_ENEMY_1_DEATH] = { 34, 4, 0 },
+    [CLIP_ENEMY_2_DEATH] = { 38, 4, 0 },
+    [CLIP_ENEMY_3_DEATH] = { 42, 4, 0 },
+};
+
+#endif // ATLAS_SPRITES_H
@@ -0,0 +1,253 @@
+/*******************************************************************************************
+*
+*   Balance simulator
+*
+*   Plays the game's own update_gameplay() without a window, driven by the autopilot, for every
+*   combination of the SWEEP_* values and a fixed set of seeds, and writes one row per combination
+*   to balance_sweep.csv: the wave games ended on (mean, p50, p90, max) and how long enemies took
+*   to die after their wave spawned (p50, p90)
+*
+*   Gameplay state is global, so runs are spread over processes: the runner starts one worker per
+*   core, a copy of itself with --worker, worker i plays combinations i, i + jobs, ... and prints
+*   its rows, the runner collects them in combination order
+*       balance_sim [--jobs n] [--seeds n]
+*
+*   The default sweep, 81 combinations of 32 seeds, plays about 1000 games per minute per worker
+*   with BUILD_MODE=RELEASE (-O2), about 350 with the default debug build
+*
+*   NOTE: Includes raylib_game.c with GAME_NO_MAIN. No window, GL or audio device is created, only
+*   raylib's input queries (always idle) and GetRandomValue() run
+*
+********************************************************************************************/
+
+#define GAME_NO_MAIN
+#include "raylib_game.c"
+
+#if defined(_WIN32)
+    #define popen _popen
+    #define pclose _pclose
+#else
+    #include <unistd.h>                     // Required for: sysconf()
+#endif
+#include <time.h>                           // Required for: clock(), clock_gettime()
+
+#define SIM_DT (1.0f/60.0f)                 // The death ray damages per frame, so games step at the 60 fps rate
+#define SIM_MAX_SECONDS 900.0f              // Games still going are stopped and count as survived
+#define SIM_SEEDS 32
+#define SIM_SEED_BASE 1
+#define SIM_MAX_WAVES 256
+#define SIM_MAX_JOBS 64
+#define SIM_MAX_ROW 256
+#define BALANCE_SWEEP_FILE "balance_sweep.csv"
+
+static const F32 SWEEP_DEATH_RAY_DAMAGE[] = { 0.25f, 0.5f, 1.0f };
+static const F32 SWEEP_ENEMY_DAMAGE[]     = { 0.5f, 1.0f, 2.0f };
+static const F32 SWEEP_ENEMY_SPEED[]      = { 1.0f, 1.5f, 2.0f };      // Tiles per second
+static const F32 SWEEP_SPELL_COST_SCALE[] = { 0.5f, 1.0f, 2.0f };
+
+#define SWEEP_LEN(values) (I32)(sizeof(values)/sizeof(values[0]))
+#define SWEEP_COUNT (SWEEP_LEN(SWEEP_DEATH_RAY_DAMAGE)*SWEEP_LEN(SWEEP_ENEMY_DAMAGE)*SWEEP_LEN(SWEEP_ENEMY_SPEED)*SWEEP_LEN(SWEEP_SPELL_COST_SCALE))
+
+// Every game of one combination
+typedef struct Sim_Result {
+    U32 games;
+    U32 survived;                   // Still alive after SIM_MAX_SECONDS
+    U32 waves[SIM_MAX_WAVES];       // Games by the wave they ended on
+    U64 kills;
+    Time_Histogram time_to_kill;    // From the wave spawning to each kill, in ms like frame times
+} Sim_Result;
+
+// Combination index to values, the first sweep changes fastest
+static Balance sweep_balance(I32 index)
+{
+    Balance result = { 0 };
+    result.death_ray_damage = SWEEP_DEATH_RAY_DAMAGE[index%SWEEP_LEN(SWEEP_DEATH_RAY_DAMAGE)];
+    index /= SWEEP_LEN(SWEEP_DEATH_RAY_DAMAGE);
+    result.enemy_damage = SWEEP_ENEMY_DAMAGE[index%SWEEP_LEN(SWEEP_ENEMY_DAMAGE)];
+    index /= SWEEP_LEN(SWEEP_ENEMY_DAMAGE);
+    result.enemy_speed = TILE_SIZE*SWEEP_ENEMY_SPEED[index%SWEEP_LEN(SWEEP_ENEMY_SPEED)];
+    index /= SWEEP_LEN(SWEEP_ENEMY_SPEED);
+    result.spell_cost_scale = SWEEP_SPELL_COST_SCALE[index%SWEEP_LEN(SWEEP_SPELL_COST_SCALE)];
+    return result;
+}
+
+static void play_game(U32 seed, Sim_Result *result)
+{
+    SetRandomSeed(seed);
+    arrsetlen(enemies, 0);
+    init_gameplay();
+    current_screen = SCREEN_GAMEPLAY;
+    game_over = false;
+    waiting_for_next_wave = false;
+    wave_timer = 0.0f;
+    autopilot.recharging = false;
+    autopilot.lap_leg = 0;
+    frame_dt = SIM_DT;
+
+    F32 time = 0.0f;
+    F32 wave_start = 0.0f;
+    while (!game_over && (time < SIM_MAX_SECONDS)) {
+        flight.current.counters = (Frame_Counters){ 0 };
+        update_autopilot();
+        update_gameplay();
+        arrsetlen(decals.pending, 0);       // Only baked by the render graph
+        time += SIM_DT;
+
+        // Deaths are counted before the wave spawns, the last kill belongs to the previous wave
+        for (I32 i = 0; i < flight.current.counters.deaths; i++) {
+            histogram_add(&result->time_to_kill, (time - wave_start)*1000.0f);
+        }
+        result->kills += flight.current.counters.deaths;
+        if (flight.current.counters.spawns > 0) wave_start = time;
+    }
+
+    result->games++;
+    if (!game_over) result->survived++;
+    result->waves[(wave_id < SIM_MAX_WAVES) ? wave_id : SIM_MAX_WAVES - 1]++;
+}
+
+static I32 wave_percentile(const Sim_Result *result, F64 percentile)
+{
+    U32 rank = (U32)ceil(result->games*percentile/100.0);
+    U32 seen = 0;
+    for (I32 i = 0; i < SIM_MAX_WAVES; i++) {
+        seen += result->waves[i];
+        if ((seen >= rank) && (seen > 0)) return i;
+    }
+    return SIM_MAX_WAVES - 1;
+}
+
+// Prints "index,row" for each of its combinations
+static void run_worker(I32 worker, I32 jobs, I32 seeds)
+{
+    SetTraceLogLevel(LOG_NONE);             // stdout is the pipe to the runner
+    autopilot.enabled = true;
+    init_particles(MAX_PARTICLES);
+
+    for (I32 index = worker; index < SWEEP_COUNT; index += jobs) {
+        balance = sweep_balance(index);
+        Sim_Result result = { 0 };
+        for (I32 seed = 0; seed < seeds; seed++) play_game(SIM_SEED_BASE + seed, &result);
+
+        U64 wave_sum = 0;
+        I32 wave_max = 0;
+        for (I32 i = 0; i < SIM_MAX_WAVES; i++) {
+            wave_sum += (U64)i*result.waves[i];
+            if (result.waves[i] > 0) wave_max = i;
+        }
+        printf("%i,%.2f,%.2f,%.2f,%.2f,%u,%u,%.2f,%i,%i,%i,%llu,%.2f,%.2f\n", index,
+            balance.death_ray_damage, balance.enemy_damage, balance.enemy_speed/TILE_SIZE, balance.spell_cost_scale,
+            result.games, result.survived, (F64)wave_sum/result.games, wave_percentile(&result, 50.0),
+            wave_percentile(&result, 90.0), wave_max, (unsigned long long)result.kills,
+            histogram_percentile(&result.time_to_kill, 50.0)/1000.0f, histogram_percentile(&result.time_to_kill, 90.0)/1000.0f);
+        fflush(stdout);
+    }
+
+    arrfree(enemies);
+    arrfree(dying_enemies);
+    arrfree(enemy_grid.start);
+    arrfree(enemy_grid.order);
+    arrfree(enemy_grid.cell);
+    arrfree(enemy_grid.separation);
+    arrfree(decals.pending);
+    free_particles();
+}
+
+// GetTime() needs a window, so the runner keeps its own wall clock
+static F64 wall_seconds(void)
+{
+#if defined(_WIN32)
+    return (F64)clock()/CLOCKS_PER_SEC;     // Wall time since the process started with MSVC's CRT
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec/1e9;
+#endif
+}
+
+static I32 core_count(void)
+{
+#if defined(_WIN32)
+    const char *count = getenv("NUMBER_OF_PROCESSORS");
+    return (count != NULL) ? atoi(count) : 1;
+#else
+    return (I32)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
+static int run_sweep(const char *program, I32 jobs, I32 seeds)
+{
+    static char rows[SWEEP_COUNT][SIM_MAX_ROW] = { 0 };
+    FILE *workers[SIM_MAX_JOBS] = { 0 };
+    F64 start = wall_seconds();
+
+    // All workers run while the pipes are read one after the other, their output is a few rows
+    for (I32 i = 0; i < jobs; i++) {
+        char command[1024] = { 0 };
+        snprintf(command, sizeof(command), "\"%s\" --worker %i %i --seeds %i", program, i, jobs, seeds);
+        workers[i] = popen(command, "r");
+        if (workers[i] == NULL) printf("Could not start worker %i\n", i);
+    }
+
+    I32 received = 0;
+    for (I32 i = 0; i < jobs; i++) {
+        if (workers[i] == NULL) continue;
+        char line[SIM_MAX_ROW] = { 0 };
+        while (fgets(line, sizeof(line), workers[i]) != NULL) {
+            char *row = NULL;
+            long index = strtol(line, &row, 10);
+            if ((row == line) || (*row != ',') || (index < 0) || (index >= SWEEP_COUNT)) continue;
+            snprintf(rows[index], SIM_MAX_ROW, "%s", row + 1);
+            received++;
+        }
+        pclose(workers[i]);
+    }
+
+    FILE *file = fopen(BALANCE_SWEEP_FILE, "w");
+    if (file == NULL) {
+        printf("Could not write %s\n", BALANCE_SWEEP_FILE);
+        return 1;
+    }
+    fprintf(file, "death_ray_damage,enemy_damage,enemy_speed_tiles,spell_cost_scale,games,survived,"
+        "wave_mean,wave_p50,wave_p90,wave_max,kills,time_to_kill_p50_s,time_to_kill_p90_s\n");
+    for (I32 i = 0; i < SWEEP_COUNT; i++) {
+        if (rows[i][0] != '\0') fputs(rows[i], file);
+    }
+    fclose(file);
+
+    F64 seconds = wall_seconds() - start;
+    I32 games = received*seeds;
+    printf("%i of %i combinations, %i games on %i workers in %.1f s", received, SWEEP_COUNT, games, jobs, seconds);
+    if (seconds > 0.0) printf(", %.0f games per minute", games*60.0/seconds);
+    printf("\nWritten to %s\n", BALANCE_SWEEP_FILE);
+
+    return (received == SWEEP_COUNT) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    I32 jobs = core_count();
+    I32 seeds = SIM_SEEDS;
+    I32 worker = -1;
+
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "--jobs") == 0) && (i + 1 < argc)) jobs = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--seeds") == 0) && (i + 1 < argc)) seeds = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--worker") == 0) && (i + 2 < argc)) {
+            worker = atoi(argv[++i]);
+            jobs = atoi(argv[++i]);
+        } else {
+            printf("Usage: balance_sim [--jobs n] [--seeds n]\n");
+            return 1;
+        }
+    }
+    if (jobs < 1) jobs = 1;
+    if (jobs > SIM_MAX_JOBS) jobs = SIM_MAX_JOBS;
+    if (seeds < 1) seeds = 1;
+
+    if (worker >= 0) {
+        run_worker(worker, jobs, seeds);
+        return 0;
+    }
+    return run_sweep(argv[0], jobs, seeds);
+}
@@ -1,13 +1,336 @@
+/*******************************************************************************************
+*
+*   Atlas generator
+*
+*   Trims every sprite listed in SPRITE_SOURCES to its opaque pixels, packs them into a single
+*   image of palette indices and writes:
+*       src/atlas.h          - packed image as code (ATLAS_DATA, one byte per pixel), see ExportImageAsCode()
+*       src/atlas_sprites.h  - Sprite_Id enum and the rect of every sprite inside the atlas,
+*                              Clip_Id enum and the keyframes of every clip in CLIP_SOURCES
+*
+*   Run from the repository root, before building the game.
+*
+*   NOTE: The FONT entry only reserves space, the game copies raylib's default font into it at
+*   load time so this tool doesn't need a window/GL context
+*
+*   NOTE: Index 0 is transparent and 1..8 are Color_Palette entries, the game resolves them to
+*   colors in its palette shader. Hit and variant colors are palette rows, not extra sprites.
+*
+********************************************************************************************/
+
 #include "raylib.h"
-#include <stdio.h>
 
-int main(void) {
-    Image img = LoadImage("src/resources/atlas.png");
-    bool ok = ExportImageAsCode(img, "src/atlas.h");
-    if (!ok) {
+#include <stdio.h>                          // Required for: printf(), fopen(), fprintf()
+#include <stdlib.h>                         // Required for: qsort()
+#include <string.h>                         // Required for: strcmp()
+
+#define ATLAS_OUTPUT_FILE "src/atlas.h"
+#define SPRITES_OUTPUT_FILE "src/atlas_sprites.h"
+
+#define PACK_PADDING 1                      // Transparent pixels between packed sprites
+#define PACK_WIDTH_STEP 32
+#define PACK_MAX_WIDTH 1024
+
+#define PALETTE_INDEX_TRANSPARENT 0
+
+// Must match Color_Palette in raylib_game.h
+static const Color PALETTE[8] = {
+    {  73,  84,  53, 255 },
+    { 138, 142,  72, 255 },
+    { 222, 191, 137, 255 },
+    { 164, 101,  62, 255 },
+    { 144,  46,  41, 255 },
+    {  36,  23,  27, 255 },
+    {  93,  69,  62, 255 },
+    { 144, 124, 104, 255 },
+};
+
+#define CELL(col, row) { (col)*16.0f, (row)*16.0f, 16.0f, 16.0f }
+
+typedef struct Sprite_Source {
+    const char *name;
+    const char *file;       // NULL reserves an empty frame
+    Rectangle frame;        // Region of the file, zero width takes the whole image
+} Sprite_Source;
+
+static const Sprite_Source SPRITE_SOURCES[] = {
+    { "PLAYER",              "src/resources/atlas.png", CELL(0, 0) },
+    { "APPRENTICE",          "src/resources/atlas.png", CELL(0, 1) },
+    { "ENEMY_0",             "src/resources/atlas.png", CELL(0, 2) },
+    { "ENEMY_1",             "src/resources/atlas.png", CELL(1, 2) },
+    { "ENEMY_2",             "src/resources/atlas.png", CELL(2, 2) },
+    { "ENEMY_3",             "src/resources/atlas.png", CELL(3, 2) },
+    { "BLOOD",               "src/resources/atlas.png", CELL(0, 3) },
+    { "ICON_NO_SPELL",       "src/resources/atlas.png", CELL(0, 9) },
+    { "ICON_MANA_RAY",       "src/resources/atlas.png", CELL(1, 9) },
+    { "ICON_DEATH_RAY",      "src/resources/atlas.png", CELL(2, 9) },
+    { "ICON_NOT_FOLLOWING",  "src/resources/atlas.png", CELL(3, 9) },
+    { "ICON_FOLLOWING",      "src/resources/atlas.png", CELL(4, 9) },
+    { "ICON_SPELL_SELECTED", "src/resources/atlas.png", CELL(5, 9) },
+    { "HOWTO",               "src/resources/howto.png", { 0 } },
+    { "FONT",                NULL,                      { 0, 0, 128, 128 } },   // raylib default font image size
+};
+
+#define SPRITE_COUNT (int)(sizeof(SPRITE_SOURCES)/sizeof(SPRITE_SOURCES[0]))
+
+#define CLIP_MAX_KEYS 8
+
+typedef struct Clip_Key {
+    const char *sprite;     // SPRITE_SOURCES name, NULL ends the clip
+    int offset_y;           // Source pixels, negative is up
+    int rotation;           // Degrees around the frame center
+    int ticks;              // Duration in animation ticks
+} Clip_Key;
+
+typedef struct Clip_Source {
+    const char *name;
+    int loop;
+    Clip_Key keys[CLIP_MAX_KEYS];
+} Clip_Source;
+
+// The art has a single frame per character, so clips bob and tilt it instead of swapping cells
+#define IDLE_CLIP(name, sprite)  { name, 1, { { sprite, 0, 0, 1 } } }
+#define WALK_CLIP(name, sprite)  { name, 1, { { sprite, 0, 0, 2 }, { sprite, -1, -4, 2 }, { sprite, 0, 0, 2 }, { sprite, -1, 4, 2 } } }
+#define CAST_CLIP(name, sprite)  { name, 1, { { sprite, 0, -6, 3 }, { sprite, -1, -6, 3 } } }
+#define DEATH_CLIP(name, sprite) { name, 0, { { sprite, -2, 20, 1 }, { sprite, -3, 45, 1 }, { sprite, -1, 70, 1 }, { sprite, 0, 90, 1 } } }
+
+// NOTE: The game picks enemy clips as CLIP_ENEMY_0_WALK + kind, keep the four kinds together
+static const Clip_Source CLIP_SOURCES[] = {
+    IDLE_CLIP("PLAYER_IDLE",      "PLAYER"),
+    WALK_CLIP("PLAYER_WALK",      "PLAYER"),
+    CAST_CLIP("PLAYER_CAST",      "PLAYER"),
+    IDLE_CLIP("APPRENTICE_IDLE",  "APPRENTICE"),
+    WALK_CLIP("APPRENTICE_WALK",  "APPRENTICE"),
+    CAST_CLIP("APPRENTICE_CAST",  "APPRENTICE"),
+    WALK_CLIP("ENEMY_0_WALK",     "ENEMY_0"),
+    WALK_CLIP("ENEMY_1_WALK",     "ENEMY_1"),
+    WALK_CLIP("ENEMY_2_WALK",     "ENEMY_2"),
+    WALK_CLIP("ENEMY_3_WALK",     "ENEMY_3"),
+    DEATH_CLIP("ENEMY_0_DEATH",   "ENEMY_0"),
+    DEATH_CLIP("ENEMY_1_DEATH",   "ENEMY_1"),
+    DEATH_CLIP("ENEMY_2_DEATH",   "ENEMY_2"),
+    DEATH_CLIP("ENEMY_3_DEATH",   "ENEMY_3"),
+};
+
+#define CLIP_COUNT (int)(sizeof(CLIP_SOURCES)/sizeof(CLIP_SOURCES[0]))
+
+typedef struct Packed_Sprite {
+    int index;
+    Image image;            // Untrimmed frame
+    Rectangle trim;         // Opaque part of the frame
+    Rectangle dst;          // Position in the atlas
+} Packed_Sprite;
+
+// Nearest palette entry, so stray colors from an editor don't break the export
+static unsigned char palette_index(Color color)
+{
+    if (color.a == 0) return PALETTE_INDEX_TRANSPARENT;
+
+    int best = 0;
+    int best_distance = 0;
+    for (int i = 0; i < 8; i++) {
+        int dr = color.r - PALETTE[i].r;
+        int dg = color.g - PALETTE[i].g;
+        int db = color.b - PALETTE[i].b;
+        int distance = dr*dr + dg*dg + db*db;
+        if ((i == 0) || (distance < best_distance)) {
+            best = i;
+            best_distance = distance;
+        }
+    }
+    return (unsigned char)(best + 1);
+}
+
+static int find_sprite(const char *name)
+{
+    for (int i = 0; i < SPRITE_COUNT; i++) if (strcmp(SPRITE_SOURCES[i].name, name) == 0) return i;
+    return -1;
+}
+
+// Tallest first, then widest, then in table order so the output is stable
+static int compare_sprites(const void *a, const void *b)
+{
+    const Packed_Sprite *sa = a;
+    const Packed_Sprite *sb = b;
+    if (sa->trim.height != sb->trim.height) return (sa->trim.height > sb->trim.height)? -1 : 1;
+    if (sa->trim.width != sb->trim.width) return (sa->trim.width > sb->trim.width)? -1 : 1;
+    return sa->index - sb->index;
+}
+
+// Skyline packing on a per-column height map: every sprite goes where its top edge is lowest,
+// leftmost on ties. Returns the atlas height for the given width.
+static int pack(Packed_Sprite *sprites, int width)
+{
+    int *skyline = calloc(width, sizeof(int));
+    int height = 0;
+
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        int w = (int)sprites[i].trim.width + PACK_PADDING;
+        int h = (int)sprites[i].trim.height + PACK_PADDING;
+        int best_x = 0;
+        int best_y = -1;
+
+        for (int x = 0; x + w <= width; x++) {
+            int y = 0;
+            for (int k = x; k < x + w; k++) if (skyline[k] > y) y = skyline[k];
+            if ((best_y < 0) || (y < best_y)) {
+                best_x = x;
+                best_y = y;
+            }
+        }
+
+        for (int k = best_x; k < best_x + w; k++) skyline[k] = best_y + h;
+        if (best_y + h > height) height = best_y + h;
+        sprites[i].dst = (Rectangle){ (float)best_x, (float)best_y, sprites[i].trim.width, sprites[i].trim.height };
+    }
+
+    free(skyline);
+    return height;
+}
+
+int main(void)
+{
+    Packed_Sprite sprites[SPRITE_COUNT] = { 0 };
+    int max_width = 0;
+
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        const Sprite_Source *source = &SPRITE_SOURCES[i];
+        Image image = { 0 };
+
+        if (source->file != NULL) {
+            Image file = LoadImage(source->file);
+            if (!IsImageReady(file)) {
+                printf("Could not load %s!\n", source->file);
+                return 1;
+            }
+            ImageFormat(&file, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            Rectangle frame = source->frame;
+            if (frame.width == 0) frame = (Rectangle){ 0, 0, (float)file.width, (float)file.height };
+            image = ImageFromImage(file, frame);
+            UnloadImage(file);
+        } else {
+            image = GenImageColor((int)source->frame.width, (int)source->frame.height, BLANK);
+        }
+
+        Rectangle trim = GetImageAlphaBorder(image, 0.0f);
+        if ((source->file == NULL) || (trim.width == 0) || (trim.height == 0)) {
+            trim = (Rectangle){ 0, 0, (float)image.width, (float)image.height };
+        }
+
+        sprites[i] = (Packed_Sprite){ .index = i, .image = image, .trim = trim };
+        if ((int)trim.width + PACK_PADDING > max_width) max_width = (int)trim.width + PACK_PADDING;
+    }
+
+    qsort(sprites, SPRITE_COUNT, sizeof(Packed_Sprite), compare_sprites);
+
+    // Try every width step and keep the one with the smallest area
+    int best_width = 0;
+    int best_area = 0;
+    int first_width = ((max_width + PACK_WIDTH_STEP - 1)/PACK_WIDTH_STEP)*PACK_WIDTH_STEP;
+    for (int width = first_width; width <= PACK_MAX_WIDTH; width += PACK_WIDTH_STEP) {
+        int area = width*pack(sprites, width);
+        if ((best_width == 0) || (area < best_area)) {
+            best_width = width;
+            best_area = area;
+        }
+    }
+    int best_height = pack(sprites, best_width);
+
+    Image atlas = GenImageColor(best_width, best_height, BLANK);
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        ImageDraw(&atlas, sprites[i].image, sprites[i].trim, sprites[i].dst, WHITE);
+    }
+
+    // One palette index per pixel, a quarter of the RGBA size
+    Image indexed = GenImageColor(best_width, best_height, BLANK);
+    ImageFormat(&indexed, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    Color *pixels = LoadImageColors(atlas);
+    unsigned char *indices = indexed.data;
+    for (int i = 0; i < best_width*best_height; i++) indices[i] = palette_index(pixels[i]);
+    UnloadImageColors(pixels);
+
+    if (!ExportImageAsCode(indexed, ATLAS_OUTPUT_FILE)) {
         printf("Could not export image!\n");
         return 1;
     }
-    UnloadImage(img);
-    return;
-}
\ No newline at end of file
+
+    FILE *file = fopen(SPRITES_OUTPUT_FILE, "w");
+    if (file == NULL) {
+        printf("Could not write %s!\n", SPRITES_OUTPUT_FILE);
+        return 1;
+    }
+
+    fprintf(file, "// Generated by gen_atlas.c, do not edit\n");
+    fprintf(file, "#ifndef ATLAS_SPRITES_H\n#define ATLAS_SPRITES_H\n\n");
+
+    fprintf(file, "typedef enum {\n");
+    for (int i = 0; i < SPRITE_COUNT; i++) fprintf(file, "    SPRITE_%s,\n", SPRITE_SOURCES[i].name);
+    fprintf(file, "    SPRITE_COUNT,\n} Sprite_Id;\n\n");
+
+    fprintf(file, "// src: trimmed sprite in the atlas, offset: src position inside the untrimmed frame\n");
+    fprintf(file, "typedef struct Atlas_Sprite {\n");
+    fprintf(file, "    Rectangle src;\n    Vector2 offset;\n    Vector2 frame;\n} Atlas_Sprite;\n\n");
+
+    fprintf(file, "static const Atlas_Sprite ATLAS_SPRITES[SPRITE_COUNT] = {\n");
+    for (int n = 0; n < SPRITE_COUNT; n++) {
+        // Written in table order, not in packing order
+        Packed_Sprite *sprite = NULL;
+        for (int i = 0; i < SPRITE_COUNT; i++) if (sprites[i].index == n) sprite = &sprites[i];
+
+        fprintf(file, "    [SPRITE_%s] = { { %d, %d, %d, %d }, { %d, %d }, { %d, %d } },\n",
+            SPRITE_SOURCES[n].name,
+            (int)sprite->dst.x, (int)sprite->dst.y, (int)sprite->dst.width, (int)sprite->dst.height,
+            (int)sprite->trim.x, (int)sprite->trim.y,
+            sprite->image.width, sprite->image.height);
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "typedef enum {\n");
+    for (int i = 0; i < CLIP_COUNT; i++) fprintf(file, "    CLIP_%s,\n", CLIP_SOURCES[i].name);
+    fprintf(file, "    CLIP_COUNT,\n} Clip_Id;\n\n");
+
+    fprintf(file, "// One keyframe: offset_y in source pixels, rotation in degrees, ticks at ANIM_TICK_RATE\n");
+    fprintf(file, "typedef struct Clip_Frame {\n");
+    fprintf(file, "    unsigned char sprite;\n    signed char offset_y;\n    signed char rotation;\n    unsigned char ticks;\n} Clip_Frame;\n\n");
+    fprintf(file, "// first: index of the clip's first keyframe in CLIP_FRAMES\n");
+    fprintf(file, "typedef struct Clip {\n");
+    fprintf(file, "    unsigned short first;\n    unsigned char count;\n    unsigned char loop;\n} Clip;\n\n");
+
+    int frame_count = 0;
+    for (int c = 0; c < CLIP_COUNT; c++) {
+        for (int k = 0; (k < CLIP_MAX_KEYS) && (CLIP_SOURCES[c].keys[k].sprite != NULL); k++) frame_count++;
+    }
+
+    fprintf(file, "static const Clip_Frame CLIP_FRAMES[%d] = {\n", frame_count);
+    for (int c = 0; c < CLIP_COUNT; c++) {
+        for (int k = 0; (k < CLIP_MAX_KEYS) && (CLIP_SOURCES[c].keys[k].sprite != NULL); k++) {
+            Clip_Key key = CLIP_SOURCES[c].keys[k];
+            if (find_sprite(key.sprite) < 0) {
+                printf("Clip %s uses unknown sprite %s!\n", CLIP_SOURCES[c].name, key.sprite);
+                fclose(file);
+                return 1;
+            }
+            fprintf(file, "    { SPRITE_%s, %d, %d, %d },\n", key.sprite, key.offset_y, key.rotation, key.ticks);
+        }
+    }
+    fprintf(file, "};\n\n");
+
+    fprintf(file, "static const Clip CLIPS[CLIP_COUNT] = {\n");
+    int first = 0;
+    for (int c = 0; c < CLIP_COUNT; c++) {
+        int count = 0;
+        while ((count < CLIP_MAX_KEYS) && (CLIP_SOURCES[c].keys[count].sprite != NULL)) count++;
+        fprintf(file, "    [CLIP_%s] = { %d, %d, %d },\n", CLIP_SOURCES[c].name, first, count, CLIP_SOURCES[c].loop);
+        first += count;
+    }
+    fprintf(file, "};\n\n#endif // ATLAS_SPRITES_H\n");
+    fclose(file);
+
+    printf("Packed %d sprites into a %dx%d atlas\n", SPRITE_COUNT, best_width, best_height);
+
+    for (int i = 0; i < SPRITE_COUNT; i++) UnloadImage(sprites[i].image);
+    UnloadImage(atlas);
+    UnloadImage(indexed);
+    return 0;
+}
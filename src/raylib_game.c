@@ -24,8 +24,16 @@
  *          - [] modify build script to use emcc and compile locally
  */
 
+// Allocations of this file go through the tracker, see tracked_malloc(). These only reach RL_*
+// calls compiled here: raylib is linked prebuilt and what it allocates itself isn't tracked
+#define RL_MALLOC(size) tracked_malloc(size)
+#define RL_CALLOC(count, size) tracked_calloc((count), (size))
+#define RL_REALLOC(ptr, size) tracked_realloc((ptr), (size))
+#define RL_FREE(ptr) tracked_free(ptr)
+
 #include "raylib.h"
 #include "raymath.h"
+#include "rlgl.h"
 
 #if defined(PLATFORM_WEB)
     #define CUSTOM_MODAL_DIALOGS            // Force custom modal dialogs usage
@@ -36,10 +44,44 @@
 #include <stdlib.h>                         // Required for:
 #include <string.h>                         // Required for:
 
+#if defined(_WIN32)
+    // windows.h clashes with raylib names, declare the only function needed
+    __declspec(dllimport) void __stdcall Sleep(unsigned long msTimeout);
+#else
+    #include <time.h>                       // Required for: nanosleep()
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define PARTICLES_SSE2
+    #include <emmintrin.h>                  // Required for: SSE2 particle integration
+#endif
+
+// USE_GLAD_HOOKS reaches into the glad loader compiled into raylib on desktop. Its symbols only resolve
+// against a static raylib, so it is opt-in: make GLAD_HOOKS=TRUE, or set GLAD_HOOKS=1 for build.bat
+#if defined(USE_GLAD_HOOKS)
+    #define COUNT_DRAW_CALLS                // Exact, through raylib's glad function pointers, see install_draw_call_counter()
+    #define LIMIT_QUEUED_FRAMES             // glFinish() after the swap in low latency modes, see present_frame()
+    #define GPU_TIMERS                      // GL_TIME_ELAPSED queries around render graph groups, see begin_gpu_timer()
+    #if defined(_WIN32)
+        #define GL_CALL __stdcall
+    #else
+        #define GL_CALL
+    #endif
+#endif
+
 #include "core.h"
+#include "atlas_sprites.h"                  // Generated by gen_atlas.c, Sprite_Id is used by raylib_game.h
 #include "raylib_game.h"
 #include "atlas.h"
+#include "shaders.h"
 
+#if defined(LIMIT_QUEUED_FRAMES)
+typedef void (GL_CALL *Gl_Finish)(void);
+extern Gl_Finish glad_glFinish;         // Defined by the glad loader compiled into raylib
+#endif
+
+#define STBDS_REALLOC(context, ptr, size) tracked_realloc((ptr), (size))
+#define STBDS_FREE(context, ptr) tracked_free(ptr)
 #define STB_DS_IMPLEMENTATION
 #include "stb_ds.h"
 
@@ -52,6 +94,7 @@ static const F32 map_width = 30*TILE_SIZE;
 static const F32 map_height = 30*TILE_SIZE;
 
 static RenderTexture2D target = { 0 };  // Render texture to render our game
+static Dynamic_Resolution dynres = { .scale = DYNRES_MAX_SCALE };
 
 // TODO: Define global variables here, recommended to make them static
 
@@ -60,9 +103,11 @@ static bool game_over = false;
 static bool gameplay_paused = false;
 static bool should_draw_debug_ui = false;
 
-static Texture howto;
-static Texture atlas;
+static Texture atlas;             // Every sprite, icon, the howto panel and the font, as palette indices
+static Palette palette_lookup = {0};
+static Font game_font = {0};      // raylib's default font glyphs, copied into the atlas
 static Texture background_texture;
+static Ray_Shader ray_shader = {0};
 
 static int frames_counter = 0;
 
@@ -74,6 +119,38 @@ static Player player = {0};
 static Apprentice apprentice = {0};
 
 static Enemy *enemies = NULL;
+static Enemy_Grid enemy_grid = {0};
+static Dying_Enemy *dying_enemies = NULL;
+static F32 anim_time = 0.0f;        // Time not yet consumed by whole animation ticks
+static Draw_List draw_list = {0};
+static Particle_System particles = {0};
+static Decal_Layer decals = {0};
+static Light_Buffer lights = {0};
+static Post_Process post = { .enabled = { [POST_BLOOM] = true, [POST_VIGNETTE] = true, [POST_PALETTE] = true } };
+static Bar_Instance *bars = NULL;   // Rebuilt every frame, capacity is kept between frames
+static Render_Graph render_graph = {0};
+static Idle_Presenter idle = {0};
+static Frame_Pacer pacer = {0};
+static Frame_Stats frame_stats = {0};
+static Tracer tracer = {0};
+static Flight_Recorder flight = { .threshold_ms = FLIGHT_RECORDER_THRESHOLD_MS };
+static Telemetry telemetry = {0};
+static Stress_Test stress = {0};
+static Autopilot autopilot = {0};
+static Balance balance = {
+    .death_ray_damage = DEATH_RAY_DAMAGE,
+    .enemy_damage     = ENEMY_DAMAGE,
+    .enemy_speed      = ENEMY_SPEED,
+    .spell_cost_scale = 1.0f,
+};
+static Alloc_Tracker allocs = {0};
+static Input_Latency latency = {0};
+static F32 frame_dt = 0.0f;             // Start to start, raylib's frame time isn't updated in low latency modes
+static F32 smoothed_frame_dt = 1.0f/PACER_TARGET_FPS;
+static U32 draw_call_count = 0;
+static U32 vertex_count = 0;
+static U32 texture_bind_count = 0;
+static Gpu_Timers gpu_timers = {0};
 static int wave_id = 0;
 static bool waiting_for_next_wave = false;
 static F32  wave_timer = 0.0f;
@@ -86,17 +163,26 @@ static Vec2 touch_start = {0};
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
-int main(void)
+// NOTE: Tools that include this file to reuse the game code (render_bench.c, balance_sim.c) define GAME_NO_MAIN
+#if !defined(GAME_NO_MAIN)
+int main(int argc, char **argv)
 {
 // #if !defined(_DEBUG)
 //     SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messages
 // #endif
 
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--stress") == 0) stress.enabled = true;
+        else if (strcmp(argv[i], "--autopilot") == 0) autopilot.enabled = true;
+        else TraceLog(LOG_WARNING, "Unknown argument: %s", argv[i]);
+    }
+
     // Initialization
     //--------------------------------------------------------------------------------------
     InitWindow(screenWidth, screenHeight, "The Apprentice");
     SetExitKey(0);
 
+    set_alloc_tag(ALLOC_LOADING);
     InitAudioDevice();
 
     // TODO: Load resources / Initialize variables at this point
@@ -111,36 +197,27 @@ int main(void)
     new_wave_sound = LoadSound("resources/new_wave.wav");
     SetSoundVolume(new_wave_sound, 0.5f);
 
-    Image atlas_image = {0};
-
-    atlas_image.format = ATLAS_FORMAT;
-    atlas_image.width = ATLAS_WIDTH;
-    atlas_image.height = ATLAS_HEIGHT;
-    atlas_image.mipmaps = 1;
-    atlas_image.data = ATLAS_DATA;
-
-    atlas = LoadTextureFromImage(atlas_image);
-    background_texture = LoadTexture("resources/Background.png");
-    howto = LoadTexture("resources/howto.png");
+    load_render_resources();
+#if defined(_DEBUG)
+    check_dynamic_resolution();
+#endif
 
+    set_alloc_tag(ALLOC_GAMEPLAY);
     init_gameplay();
+    set_alloc_tag(ALLOC_GENERAL);
     camera.target = player.pos;
     camera.offset = (Vec2) {screenWidth/2 - TILE_SIZE/2, screenHeight/2 - TILE_SIZE/2};
     camera.zoom = 1.0f;
-
-    // Render texture to draw full screen, enables screen scaling
-    // NOTE: If screen is scaled, mouse input should be scaled proportionally
-    target = LoadRenderTexture(screenWidth, screenHeight);
-    SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
+    if (stress.enabled) start_stress_test();
 
 #if defined(PLATFORM_WEB)
     emscripten_set_main_loop(UpdateDrawFrame, 60, 1);
 #else
-    SetTargetFPS(60);     // Set our game frames-per-second
+    init_frame_pacer(PACER_FREE_RUN);   // Frame rate is limited by pace_frame(), not SetTargetFPS()
     //--------------------------------------------------------------------------------------
 
     // Main game loop
-    while (!WindowShouldClose())    // Detect window close button
+    while (!WindowShouldClose() && !stress.finished)    // Detect window close button
     {
         UpdateDrawFrame();
     }
@@ -151,11 +228,25 @@ int main(void)
     UnloadMusicStream(music);
     UnloadSound(death_sound);
     UnloadSound(new_wave_sound);
-    UnloadRenderTexture(target);
-    UnloadTexture(atlas);
-    UnloadTexture(background_texture);
+    unload_render_resources();
+    save_frame_stats(FRAME_STATS_FILE);
+    finish_telemetry();
+    if (tracer.enabled) stop_trace();
+    if (autopilot.enabled) TraceLog(LOG_INFO, "AUTOPILOT: %i games over, best wave %i", autopilot.games, autopilot.best_wave);
 
     arrfree(enemies);
+    arrfree(dying_enemies);
+    arrfree(enemy_grid.start);
+    arrfree(enemy_grid.order);
+    arrfree(enemy_grid.cell);
+    arrfree(enemy_grid.separation);
+    arrfree(bars);
+    arrfree(draw_list.sprites);
+    arrfree(draw_list.keys);
+    arrfree(draw_list.records);
+    arrfree(draw_list.scratch);
+    arrfree(draw_list.prev_order);
+    report_allocations();
 
     // TODO: Unload all loaded resources at this point
 
@@ -165,23 +256,84 @@ int main(void)
 
     return 0;
 }
+#endif // GAME_NO_MAIN
 
 //--------------------------------------------------------------------------------------------
 // Module functions definition
 //--------------------------------------------------------------------------------------------
+// Everything the render graph needs. Also used by render_bench.c, which draws without audio
+void load_render_resources(void) {
+    install_draw_call_counter();
+    init_gpu_timers();
+
+    Alloc_Tag previous_tag = set_alloc_tag(ALLOC_LOADING);
+    load_palette();
+    load_atlas();
+    background_texture = load_indexed_texture("resources/Background.png");
+    decals.texture = LoadRenderTexture(background_texture.width, background_texture.height);
+    decals.clear = true;
+    init_particles(MAX_PARTICLES);
+    load_ray_shader();
+
+    // Render texture to draw full screen, enables screen scaling
+    // NOTE: If screen is scaled, mouse input should be scaled proportionally
+    target = LoadRenderTexture(screenWidth, screenHeight);
+    SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
+
+    Image falloff = GenImageGradientRadial(64, 64, 0.0f, WHITE, BLANK);
+    lights.falloff = LoadTextureFromImage(falloff);
+    SetTextureFilter(lights.falloff, TEXTURE_FILTER_BILINEAR);
+    UnloadImage(falloff);
+    resize_light_buffer();
+    load_post_process();
+    set_alloc_tag(previous_tag);
+}
+
+void unload_render_resources(void) {
+    UnloadRenderTexture(target);
+    UnloadRenderTexture(lights.texture);
+    UnloadTexture(lights.falloff);
+    unload_post_process();
+    unload_gpu_timers();
+    uninstall_draw_call_counter();
+    unload_atlas();
+    unload_palette();
+    UnloadTexture(background_texture);
+    UnloadRenderTexture(decals.texture);
+    arrfree(decals.pending);
+    free_particles();
+    UnloadShader(ray_shader.shader);
+}
+
 // Update and draw frame
 void UpdateDrawFrame(void)
 {
+    if (wait_while_idle()) return;
+
+    F64 frame_start = GetTime();
+    if (frame_stats.last_start > 0.0) frame_dt = fminf((F32)(frame_start - frame_stats.last_start), MAX_FRAME_DT);
+    smoothed_frame_dt = Lerp(smoothed_frame_dt, frame_dt, 0.05f);
+    latency.polled = false;
+    record_frame_time(frame_start);
+    record_flight_frame(frame_start);
+    end_alloc_frame();
+    update_tracer();
+    I32 frame_zone = trace_begin("frame");
+
     // Update
     //----------------------------------------------------------------------------------
     // TODO: Update variables / Implement example logic at this point
     //----------------------------------------------------------------------------------
     UpdateMusicStream(music);
+    F64 section_start = end_flight_section(FLIGHT_MUSIC, frame_start);
+    F64 update_start = section_start;
+    set_alloc_tag(ALLOC_GAMEPLAY);
+    if (autopilot.enabled) update_autopilot();
 
     switch (current_screen) {
     case SCREEN_TITLE: 
         {
-            if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE) || IsGestureDetected(GESTURE_TAP)) {
+            if (key_pressed(KEY_ENTER) || key_pressed(KEY_SPACE) || IsGestureDetected(GESTURE_TAP)) {
                 current_screen = SCREEN_GAMEPLAY;
             }
 
@@ -196,6 +348,7 @@ void UpdateDrawFrame(void)
                     else ResumeMusicStream(music);
                 }
 
+                if (stress.enabled && !gameplay_paused) update_stress_test();
                 if (!gameplay_paused) update_gameplay();
             } else {
                 arrsetlen(enemies, 0);
@@ -205,7 +358,7 @@ void UpdateDrawFrame(void)
 
     case SCREEN_ENDING:
         {
-            if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE) || IsGestureDetected(GESTURE_TAP)) {
+            if (key_pressed(KEY_ENTER) || key_pressed(KEY_SPACE) || IsGestureDetected(GESTURE_TAP)) {
                 init_gameplay();
                 game_over = false;
                 current_screen = SCREEN_TITLE;
@@ -214,254 +367,1563 @@ void UpdateDrawFrame(void)
         } break;
     }
 
+    // Late latch: the one poll of the frame happens here and only the player moves with it
+    if (latency.mode == LATENCY_LATE_LATCH && current_screen == SCREEN_GAMEPLAY && !gameplay_paused && !game_over) {
+        poll_input();
+        update_player_movement(frame_dt);
+    }
+    section_start = end_flight_section(FLIGHT_UPDATE, section_start);
+    F64 draw_start = section_start;
+
     // Draw
     //----------------------------------------------------------------------------------
-    // Render game screen to a texture,
-    // it could be useful for scaling or further shader postprocessing
-    BeginTextureMode(target);
-        ClearBackground(BLANK);
-        if (current_screen == SCREEN_GAMEPLAY) draw_gameplay();
-    EndTextureMode();
+    // Passes render through the frame graph, which also calls BeginDrawing()
+    set_alloc_tag(ALLOC_RENDER);
+    build_render_graph();
+    execute_render_graph();
+    section_start = end_flight_section(FLIGHT_DRAW, section_start);
+    F64 draw_end = section_start;
+
+    I32 present_zone = trace_begin("present");
+    present_frame();
+    trace_end(present_zone);
+    section_start = end_flight_section(FLIGHT_PRESENT, section_start);
+    //----------------------------------------------------------------------------------
 
-    // Render to screen (main framebuffer)
-    BeginDrawing();
-        ClearBackground(PAL5);
+    if (stress.enabled && !gameplay_paused) {
+        record_stress_frame((F32)((section_start - frame_start)*1000.0), (F32)((draw_start - update_start)*1000.0),
+            (F32)((draw_end - draw_start)*1000.0));
+    }
 
-        // Draw render texture to screen, scaled if required
-        DrawTexturePro(target.texture,
-            (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height },
-            (Rectangle){ 0, 0, (float)target.texture.width, (float)target.texture.height  },
-            (Vector2){ 0, 0 },
-            0.0f,
-            WHITE);
-        // DrawTextureEx(background_texture, (Vec2){0, 0}, 0.0f, TILE_UPSCALE_FACTOR, WHITE);
+    idle.presented = is_static_frame();
+    idle.present_time = GetTime();
+    record_telemetry();
 
+#if !defined(PLATFORM_WEB)
+    I32 pace_zone = trace_begin("pace_frame");
+    plan_low_latency_start(frame_start);
+    pace_frame();
+    trace_end(pace_zone);
+    end_flight_section(FLIGHT_PACE, section_start);
+#endif
+    // Low latency modes poll after the pacer sleep, right before the next frame starts
+    if (!latency.polled) poll_input();
+
+    // Resize the world target outside of drawing, it takes effect next frame.
+    // Not while paused, the pause screen keeps showing the last world frame
+    // The stress test keeps the native resolution, so its steps draw the same pixels
+    if (!idle.presented && !stress.enabled) {
+        update_dynamic_resolution((F32)((draw_end - frame_start)*1000.0), (F32)((section_start - draw_end)*1000.0));
+    }
+    set_alloc_tag(ALLOC_GENERAL);
+    trace_end(frame_zone);
+}
 
-        // TODO: Draw everything that requires to be drawn at this point, maybe UI?
-        if (current_screen == SCREEN_TITLE) {
-            DrawTextureEx(howto, (Vec2) {TILE_SIZE, 0}, 0.0f, 3, WHITE);
-        }
+// Plain OS sleep, may oversleep by the scheduler granularity
+void sleep_seconds(F64 seconds) {
+    if (seconds <= 0.0) return;
+#if defined(_WIN32)
+    Sleep((unsigned long)(seconds*1000.0));
+#else
+    struct timespec request = { (time_t)seconds, (long)((seconds - (F64)(time_t)seconds)*1e9) };
+    nanosleep(&request, NULL);
+#endif
+}
 
-        if (current_screen == SCREEN_GAMEPLAY) {
-            draw_ui();
-            if (should_draw_debug_ui) draw_debug_ui();
-        }
+// Measures how late short sleeps wake up, the pacer stops sleeping that much before a deadline
+void init_frame_pacer(Pacer_Mode mode) {
+    SetTargetFPS(0);
 
-        if (current_screen == SCREEN_ENDING) {
-            const char *text = "GAME OVER"; 
-            F32 fontsize = 40;
-            int font_width = MeasureText(text, fontsize);
-            DrawText(text, screenWidth/2 - font_width/2, screenHeight/2 - fontsize/2, fontsize, PAL2);
-        }
+    F64 worst = 0.0;
+    for (int i = 0; i < PACER_CALIBRATION_SAMPLES; i++) {
+        F64 start = GetTime();
+        sleep_seconds(0.001);
+        F64 overshoot = GetTime() - start - 0.001;
+        if (overshoot > worst) worst = overshoot;
+    }
+    pacer = (Frame_Pacer){ .spin_margin = Clamp((F32)(worst*1.5), PACER_MIN_SPIN_MARGIN, PACER_MAX_SPIN_MARGIN) };
+    TraceLog(LOG_INFO, "PACER: Sleep overshoot %.3f ms, spinning the last %.3f ms", worst*1000.0, pacer.spin_margin*1000.0);
 
-    EndDrawing();
-    //----------------------------------------------------------------------------------
+    set_pacer_mode(mode);
 }
 
-void init_gameplay(void) {
-    player = (Player){
-        .pos = (Vec2){map_height/2.0f - TILE_SIZE/2, map_width/2.0f - TILE_SIZE/2},
-        .speed = TILE_SIZE*3,
-
-        .health = 100.0f,
-        .max_health = 100.0f,
-        .is_invincible = false,
-        .invincibility_timer = 5.0f, 
+void set_pacer_mode(Pacer_Mode mode) {
+    pacer.mode = mode;
+    pacer.period = 1.0/PACER_TARGET_FPS;
 
-        .mana = 100.0f,
-        .max_mana = 100.0f,
-        .mana_regen = 10.0f,
-    };
+    if (mode == PACER_VSYNC) {
+        SetWindowState(FLAG_VSYNC_HINT);
+        int refresh_rate = GetMonitorRefreshRate(GetCurrentMonitor());
+        if (refresh_rate > 0) pacer.period = 1.0/refresh_rate;
+    } else {
+        ClearWindowState(FLAG_VSYNC_HINT);
+    }
 
-    apprentice = (Apprentice) {
-        .pos = (Vec2){map_width/2.0f - TILE_SIZE/2 - 30, map_height/2.0f - TILE_SIZE/2 - 30},
-        .speed = TILE_SIZE*2.8f,
-        .following_player = true,
+    pacer.deadline = GetTime() + pacer.period;
+    pacer.frames = 0;
+    pacer.late_frames = 0;
+    pacer.error_sum = 0.0;
+    pacer.error_sq_sum = 0.0;
+    pacer.max_error = 0.0;
+    pacer.spin_time = 0.0;
+}
 
-        .health = 100.0f,
-        .max_health = 100.0f,
-        .is_invincible = false,
-        .invincibility_timer = 5.0f, 
+// Waits for the next frame deadline. With vsync the buffer swap already blocked until about the
+// deadline, so this only sleeps when the driver ignores the swap interval
+void pace_frame(void) {
+    F64 remaining = pacer.deadline - GetTime();
+    if (remaining > pacer.spin_margin) sleep_seconds(remaining - pacer.spin_margin);
+
+    F64 spin_start = GetTime();
+    F64 now = spin_start;
+    while (now < pacer.deadline) now = GetTime();
+    pacer.spin_time += now - spin_start;
+
+    F64 error = now - pacer.deadline;
+    pacer.frames++;
+    pacer.error_sum += error;
+    pacer.error_sq_sum += error*error;
+    if (error > pacer.max_error) pacer.max_error = error;
+    if (error > PACER_LATE_THRESHOLD) pacer.late_frames++;
+
+    // A long frame resyncs instead of rushing the following ones to catch up
+    pacer.deadline += pacer.period;
+    if (pacer.deadline < now) pacer.deadline = now + pacer.period;
+}
 
-        .mana = 0.0f,
-        .max_mana = 100.0f,
-        .mana_regen = 1.0f,
-    };
+// The autopilot needs frames to press its keys, its screens are never static
+bool is_static_frame(void) {
+    return (current_screen != SCREEN_GAMEPLAY || gameplay_paused) && !autopilot.enabled;
+}
 
-    wave_id = 1;
-    int number_of_enemies = 2;
-    for (int i = 0; i < number_of_enemies; i++) {
-        F32 angle = (2.0f * PI * i) / number_of_enemies;
-        F32 radius = 500.0f;
-        Enemy enemy = {
-            .id = i,
-            .alive = true,
-            .pos = (Vec2){
-                (F32)map_width/2  + radius * cosf(angle),
-                (F32)map_height/2 + radius * sinf(angle)},
-            .speed = TILE_SIZE*1.5f,
+// Skips the frame while a static screen is up and nothing happened: only music and input are
+// updated. Returns false when the frame has to run, on input or to re-present the static frame
+bool wait_while_idle(void) {
+    if (!idle.presented) return false;
 
-            .health = 100.0f,
-            .max_health = 100.0f,
-        };
-        arrput(enemies, enemy);
+    // Checked before polling again, a poll drops the presses of the previous one
+    if (input_activity() || IsWindowResized()) {
+        idle.presented = false;
+        return false;
     }
+    if (GetTime() - idle.present_time >= IDLE_REPRESENT_INTERVAL) return false;
 
+    UpdateMusicStream(music);
+#if !defined(PLATFORM_WEB)
+    sleep_seconds(IDLE_POLL_INTERVAL);  // The browser paces the main loop on web
+#endif
+    poll_input();
+    return true;
 }
 
-void update_gameplay(void) {
-    F32 dt = GetFrameTime();
-    frames_counter = 0;
-    frames_counter++;
+bool input_activity(void) {
+    if (GetKeyPressed() != 0) return true;
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_BACK; button++) {
+        if (IsMouseButtonPressed(button)) return true;
+    }
+    if (GetMouseWheelMove() != 0.0f) return true;
+    if (GetTouchPointCount() > 0) return true;
+    return false;
+}
 
-    if (IsKeyPressed(KEY_TAB)) {
-        const char* text = should_draw_debug_ui ? "Hiding atlas" : "Showing atlas";
-        TraceLog(LOG_INFO, text);
-        should_draw_debug_ui = !should_draw_debug_ui;
+// The default mode is EndDrawing(), which polls input right after the swap, before the pacer
+// sleeps. Low latency modes swap, wait for the GPU so no frame stays queued, and poll later.
+// NOTE: The wait needs glFinish() from USE_GLAD_HOOKS, without it the driver may still queue a frame
+void present_frame(void) {
+    if (latency.mode == LATENCY_DEFAULT) {
+        EndDrawing();
+        F64 now = GetTime();
+        note_present(now);
+        note_input_poll(now);
+        latency.polled = true;
+        return;
     }
 
-    // PLAYER
+    rlDrawRenderBatchActive();
+    SwapScreenBuffer();
+#if defined(LIMIT_QUEUED_FRAMES)
+    glad_glFinish();
+#endif
+    note_present(GetTime());
+}
 
-    Vec2 input = {0};
+// Only place input is polled outside EndDrawing(), once per frame so no press is dropped
+void poll_input(void) {
+    PollInputEvents();
+    note_input_poll(GetTime());
+    latency.polled = true;
+}
 
-    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) {
-        input.y += 1;
-    }
-    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP)) {
-        input.y -= 1;
+void note_input_poll(F64 time) {
+    if (latency.input_time == 0.0 && input_activity()) latency.input_time = time;
+}
+
+// The first present after a poll that delivered input shows its result
+void note_present(F64 time) {
+    latency.present_time = time;
+    if (latency.input_time == 0.0) return;
+
+    F64 delay = time - latency.input_time;
+    latency.input_time = 0.0;
+    latency.last = delay;
+    latency.sum += delay;
+    latency.samples++;
+    if (delay > latency.max) latency.max = delay;
+}
+
+// With vsync the swap returns at the vblank, so the next frame is started its peak work time
+// before the following one and input is read as late as the frame still makes it.
+// Free running frames keep their deadlines, polling after the sleep is the whole gain there
+void plan_low_latency_start(F64 frame_start) {
+    latency.work = fmax(latency.present_time - frame_start, latency.work*LATENCY_WORK_DECAY);
+    if (latency.mode == LATENCY_DEFAULT || pacer.mode != PACER_VSYNC) return;
+
+    pacer.deadline = latency.present_time + pacer.period - latency.work - LATENCY_WORK_MARGIN;
+}
+
+// Records the frame that started at the previous call, start to start so the pacer wait and
+// the buffer swap are included. Frames ending on a static screen are left out, the idle wait
+// before the next frame is not stutter
+void record_frame_time(F64 frame_start) {
+    F64 last_start = frame_stats.last_start;
+    frame_stats.last_start = frame_start;
+    if (last_start <= 0.0 || is_static_frame()) return;
+
+    F64 seconds = frame_start - last_start;
+    F32 ms = (F32)(seconds*1000.0);
+    histogram_add(&frame_stats.times, ms);
+    for (I32 i = 0; i < FRAME_STUTTER_LEVELS; i++) {
+        if (ms > FRAME_STUTTER_MS[i] + FRAME_STUTTER_SLACK_MS) frame_stats.stutters[i]++;
     }
-    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) {
-        input.x -= 1;
-        player.flip_texture = FLIP_X;
+
+    I32 slot = frame_stats.worst_count;
+    if (slot == FRAME_WORST_COUNT) {
+        if (ms <= frame_stats.worst[slot - 1].ms) return;
+        slot--;
+    } else {
+        frame_stats.worst_count++;
     }
-    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) {
-        input.x += 1;
-        player.flip_texture = NO_FLIP;
+    for (; slot > 0 && frame_stats.worst[slot - 1].ms < ms; slot--) {
+        frame_stats.worst[slot] = frame_stats.worst[slot - 1];
     }
+    frame_stats.worst[slot] = (Worst_Frame){ ms, last_start, wave_id, (I32)arrlen(enemies) };
+}
 
-    // Touch controls
-    Rect follow_icon_dst = (Rect) {20, screenHeight - 20 - 64, 64, 64};
-    Rect no_spell_icon_dst  = (Rect) {screenWidth - 30- 3*64, screenHeight - 20 - 64, 64, 64};
-    Rect mana_ray_icon_dst  = (Rect) {screenWidth - 25- 2*64, screenHeight - 20 - 64, 64, 64};
-    Rect death_ray_icon_dst = (Rect) {screenWidth - 20 - 64, screenHeight - 20 - 64 , 64, 64};
+// Bucket of a frame time in microseconds: exact below FRAME_HISTOGRAM_SUB_BUCKETS, then the
+// FRAME_HISTOGRAM_SUB_BITS bits under the highest set bit pick the bucket inside its power of two
+I32 frame_histogram_bucket(U32 us) {
+    if (us < FRAME_HISTOGRAM_SUB_BUCKETS) return (I32)us;
 
-    if (GetGestureDetected() == GESTURE_TAP) {
-        touch_active = true;
-        touch_start = GetTouchPosition(0);
+    I32 high_bit = 31;
+    while (!(us >> high_bit)) high_bit--;
+    I32 shift = high_bit - FRAME_HISTOGRAM_SUB_BITS;
+    return (shift + 1)*FRAME_HISTOGRAM_SUB_BUCKETS + (I32)(us >> shift) - FRAME_HISTOGRAM_SUB_BUCKETS;
+}
+
+// Smallest value of a bucket, the bucket ends where the next one starts
+U64 frame_histogram_lower(I32 bucket) {
+    if (bucket < FRAME_HISTOGRAM_SUB_BUCKETS) return (U64)bucket;
+
+    I32 shift = bucket/FRAME_HISTOGRAM_SUB_BUCKETS - 1;
+    return (U64)(bucket%FRAME_HISTOGRAM_SUB_BUCKETS + FRAME_HISTOGRAM_SUB_BUCKETS) << shift;
+}
+
+void histogram_add(Time_Histogram *histogram, F32 ms) {
+    U32 us = (U32)fmin(ms*1000.0, (F64)UINT32_MAX);
+    histogram->buckets[frame_histogram_bucket(us)]++;
+    histogram->count++;
+    histogram->total_ms += ms;
+    if (ms > histogram->max_ms) histogram->max_ms = ms;
+}
+
+// Upper edge of the bucket holding the percentile, in ms, never above the longest time
+F32 histogram_percentile(const Time_Histogram *histogram, F64 percentile) {
+    if (histogram->count == 0) return 0.0f;
+
+    U64 rank = (U64)ceil(percentile/100.0*histogram->count);
+    if (rank < 1) rank = 1;
+    U64 seen = 0;
+    for (I32 i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++) {
+        seen += histogram->buckets[i];
+        if (seen >= rank) return fminf(frame_histogram_lower(i + 1)/1000.0f, histogram->max_ms);
     }
+    return histogram->max_ms;
+}
 
-    if (CheckCollisionPointRec(touch_start, no_spell_icon_dst)) {
-        player.active_spell = NO_SPELL;
-        touch_start = (Vec2) {0};
+// Percentiles, stutter counts, the histogram between 1 and 65 ms on a log count scale
+// with the stutter levels marked, and the worst frames
+void draw_frame_stats(int x, int y) {
+    const Time_Histogram *times = &frame_stats.times;
+    if (times->count == 0) {
+        draw_text("Frame times: no gameplay frames yet", x, y, 10, PAL4);
+        return;
     }
-    if (CheckCollisionPointRec(touch_start, mana_ray_icon_dst)) {
-        player.active_spell = MANA_RAY;
-        touch_start = (Vec2) {0};
+
+    draw_text(TextFormat("Frame times: %u frames, mean %.2f ms", times->count,
+        times->total_ms/times->count), x, y, 10, PAL4);
+    draw_text(TextFormat("p50 %6.2f  p99   %6.2f  max %6.2f",
+        histogram_percentile(times, 50.0), histogram_percentile(times, 99.0), times->max_ms), x, y + 12, 10, PAL4);
+    draw_text(TextFormat("p90 %6.2f  p99.9 %6.2f ms",
+        histogram_percentile(times, 90.0), histogram_percentile(times, 99.9)), x, y + 24, 10, PAL4);
+    draw_text(TextFormat(">%.1f ms: %u  >%.1f ms: %u  >%.1f ms: %u",
+        FRAME_STUTTER_MS[0], frame_stats.stutters[0], FRAME_STUTTER_MS[1], frame_stats.stutters[1],
+        FRAME_STUTTER_MS[2], frame_stats.stutters[2]), x, y + 36, 10, PAL4);
+
+    I32 first = frame_histogram_bucket(1000);
+    I32 last = frame_histogram_bucket(65535);
+    U32 highest = 1;
+    for (I32 i = first; i <= last; i++) {
+        if (times->buckets[i] > highest) highest = times->buckets[i];
     }
-    if (CheckCollisionPointRec(touch_start, death_ray_icon_dst)) {
-        player.active_spell = DEATH_RAY;
-        touch_start = (Vec2) {0};
+    int base_y = y + 52 + 32;
+    for (I32 i = first; i <= last; i++) {
+        if (times->buckets[i] == 0) continue;
+        F32 height = 32.0f*log2f(times->buckets[i] + 1.0f)/log2f(highest + 1.0f);
+        DrawRectangleV((Vec2){ (F32)(x + (i - first)*2), base_y - height }, (Vec2){ 2.0f, height }, PAL4);
+    }
+    for (I32 i = 0; i < FRAME_STUTTER_LEVELS; i++) {
+        int level_x = x + (frame_histogram_bucket((U32)(FRAME_STUTTER_MS[i]*1000.0f)) - first)*2;
+        DrawLine(level_x, base_y - 34, level_x, base_y, PAL3);
     }
 
-    if (touch_active && GetTouchPointCount() > 0) {
-        Vec2 current_touch = GetTouchPosition(0);
-        Vec2 direction = Vector2Subtract(current_touch, touch_start);
-        
-        float min_distance = 10.0f;
-        if (Vector2Length(direction) > min_distance) {
-            input = Vector2Normalize(direction);
-            
-            if (input.x < 0) {
-                player.flip_texture = FLIP_X;
-            } else if (input.x > 0) {
-                player.flip_texture = NO_FLIP;
-            }
-        }
+    for (I32 i = 0; i < frame_stats.worst_count && i < 3; i++) {
+        Worst_Frame worst = frame_stats.worst[i];
+        draw_text(TextFormat("%6.2f ms  wave %i  %i enemies", worst.ms,
+            worst.wave_id, worst.enemy_count), x, base_y + 6 + i*12, 10, PAL4);
     }
+}
 
-    if (GetTouchPointCount() == 0) {
-        touch_active = false;
+// Written on exit so stutter can be compared between sessions and builds
+void save_frame_stats(const char *file_name) {
+    const Time_Histogram *times = &frame_stats.times;
+    if (times->count == 0) return;
+
+    FILE *file = fopen(file_name, "w");
+    if (file == NULL) {
+        TraceLog(LOG_WARNING, "FRAME STATS: Failed to open %s", file_name);
+        return;
     }
 
-    input = Vector2Normalize(input);
+    fprintf(file, "{\n");
+    fprintf(file, "  \"build\": \"%s %s\",\n", __DATE__, __TIME__);
+    fprintf(file, "  \"frames\": %u,\n", times->count);
+    fprintf(file, "  \"mean_ms\": %.3f,\n", times->total_ms/times->count);
+    fprintf(file, "  \"max_ms\": %.3f,\n", times->max_ms);
+    fprintf(file, "  \"percentiles_ms\": { \"50\": %.3f, \"90\": %.3f, \"99\": %.3f, \"99.9\": %.3f },\n",
+        histogram_percentile(times, 50.0), histogram_percentile(times, 90.0), histogram_percentile(times, 99.0), histogram_percentile(times, 99.9));
+
+    fprintf(file, "  \"frames_over_ms\": {");
+    for (I32 i = 0; i < FRAME_STUTTER_LEVELS; i++) {
+        fprintf(file, "%s \"%.1f\": %u", i > 0 ? "," : "", FRAME_STUTTER_MS[i], frame_stats.stutters[i]);
+    }
+    fprintf(file, " },\n");
+
+    // Only the buckets that were hit, bounds in microseconds, upper bound exclusive
+    fprintf(file, "  \"histogram_us\": [");
+    bool first = true;
+    for (I32 i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++) {
+        if (times->buckets[i] == 0) continue;
+        fprintf(file, "%s\n    { \"lower\": %llu, \"upper\": %llu, \"count\": %u }", first ? "" : ",",
+            (unsigned long long)frame_histogram_lower(i), (unsigned long long)frame_histogram_lower(i + 1),
+            times->buckets[i]);
+        first = false;
+    }
+    fprintf(file, "\n  ],\n");
 
-    player.pos = Vector2Add(player.pos, Vector2Scale(input, player.speed*dt));
-    player.pos = Vector2Clamp(player.pos, (Vec2){0, 0}, (Vec2){map_width, map_height});
+    fprintf(file, "  \"worst_frames\": [");
+    for (I32 i = 0; i < frame_stats.worst_count; i++) {
+        Worst_Frame worst = frame_stats.worst[i];
+        fprintf(file, "%s\n    { \"ms\": %.3f, \"time\": %.3f, \"wave\": %i, \"enemies\": %i }", i > 0 ? "," : "",
+            worst.ms, worst.time, worst.wave_id, worst.enemy_count);
+    }
+    fprintf(file, "\n  ]\n}\n");
+    fclose(file);
 
-    camera.target = player.pos;
+    TraceLog(LOG_INFO, "FRAME STATS: Saved %u frames to %s", times->count, file_name);
+}
 
-    player.health = Clamp(player.health, 0.0f, player.max_health);
-    player.invincibility_timer -= dt;
-    if (player.invincibility_timer <= 0) player.is_invincible = false;
+// Called after the present. A wave's window closes once the frame that cleared it is added,
+// or when the run ended and the ending screen is up
+void record_telemetry(void) {
+    if (current_screen == SCREEN_GAMEPLAY && !gameplay_paused) {
+        if (telemetry.wave.update.count == 0) telemetry.wave_id = wave_id;
+        add_telemetry_frame(&telemetry.wave);
 
-    apprentice.health = Clamp(apprentice.health, 0.0f, apprentice.max_health);
-    apprentice.invincibility_timer -= dt;
-    if (apprentice.invincibility_timer <= 0) apprentice.is_invincible = false;
+        if (telemetry.per_second) {
+            add_telemetry_frame(&telemetry.second);
+            if (telemetry.second.seconds >= 1.0) end_telemetry_window(&telemetry.second, "second", "");
+        }
+    }
 
-    if (player.health <= 0 || apprentice.health <= 0) {
-        game_over = true;
+    if (wave_id != telemetry.wave_id) end_telemetry_window(&telemetry.wave, "wave", "cleared");
+    if (current_screen != SCREEN_GAMEPLAY) end_telemetry_window(&telemetry.wave, "wave", "game_over");
+}
+
+void add_telemetry_frame(Telemetry_Window *window) {
+    histogram_add(&window->update, flight.current.section_ms[FLIGHT_UPDATE]);
+    histogram_add(&window->draw, flight.current.section_ms[FLIGHT_DRAW]);
+    window->seconds += frame_dt;
+    window->draw_calls += render_graph_draw_calls();
+    window->kills += flight.current.counters.deaths;
+    if ((U32)arrlen(enemies) > window->enemy_peak) window->enemy_peak = (U32)arrlen(enemies);
+    if (allocs.live_bytes > window->memory_peak) window->memory_peak = allocs.live_bytes;
+}
+
+// Formats the window as a row and resets it, an empty window is left as it is
+void end_telemetry_window(Telemetry_Window *window, const char *kind, const char *end) {
+    U32 frames = window->update.count;
+    if (frames == 0) return;
+
+    if (telemetry.length > TELEMETRY_BUFFER_SIZE - TELEMETRY_MAX_ROW) flush_telemetry();
+    telemetry.length += snprintf(telemetry.buffer + telemetry.length, TELEMETRY_BUFFER_SIZE - telemetry.length,
+        "%s,%.3f,%i,%s,%.3f,%u,%u,%u,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+        kind, GetTime(), telemetry.wave_id, end, window->seconds, frames, window->enemy_peak, window->kills,
+        window->update.total_ms/frames, histogram_percentile(&window->update, 99.0),
+        window->draw.total_ms/frames, histogram_percentile(&window->draw, 99.0),
+        (F64)window->draw_calls/frames, allocs.live_bytes/1024.0, window->memory_peak/1024.0,
+        player.health, apprentice.health);
+    telemetry.rows++;
+    *window = (Telemetry_Window){0};
+}
+
+// The file is opened with the first flush, sessions that never play don't leave one
+void flush_telemetry(void) {
+    if (telemetry.length == 0) return;
+
+    if (telemetry.file == NULL) {
+        telemetry.file = fopen(TELEMETRY_FILE, "w");
+        if (telemetry.file == NULL) {
+            TraceLog(LOG_WARNING, "TELEMETRY: Failed to open %s", TELEMETRY_FILE);
+            telemetry.length = 0;
+            return;
+        }
+        fprintf(telemetry.file, "kind,time,wave,end,seconds,frames,enemy_peak,kills,update_avg_ms,update_p99_ms,"
+            "draw_avg_ms,draw_p99_ms,draw_calls_per_frame,memory_kb,memory_peak_kb,player_health,apprentice_health\n");
     }
-    
-    player.ray_anchor     = Vector2Add(SPRITE_CENTER(player.pos), (Vec2){0, 24});
-    apprentice.ray_anchor = Vector2Add(SPRITE_CENTER(apprentice.pos), (Vec2){0, 24});
-    F32 spellray_distance = Vector2Distance(player.ray_anchor, apprentice.ray_anchor);
+    fwrite(telemetry.buffer, 1, telemetry.length, telemetry.file);
+    telemetry.length = 0;
+}
 
-    if (IsKeyPressed(KEY_Q)) {
-        player.active_spell = NO_SPELL; 
+void finish_telemetry(void) {
+    end_telemetry_window(&telemetry.wave, "wave", "exit");
+    end_telemetry_window(&telemetry.second, "second", "");
+    flush_telemetry();
+    if (telemetry.file != NULL) {
+        fclose(telemetry.file);
+        TraceLog(LOG_INFO, "TELEMETRY: Wrote %u rows to %s", telemetry.rows, TELEMETRY_FILE);
     }
+}
 
-    if (IsKeyPressed(KEY_E)) {
-        player.active_spell = MANA_RAY;
+// Gameplay keys go through these, so the autopilot drives the same code paths as the keyboard
+bool key_down(int key) {
+    if (IsKeyDown(key)) return true;
+    for (I32 i = 0; i < autopilot.down_count; i++) {
+        if (autopilot.down[i] == key) return true;
     }
-    if (IsKeyPressed(KEY_R)) {
-        player.active_spell = DEATH_RAY;
+    return false;
+}
+
+bool key_pressed(int key) {
+    if (IsKeyPressed(key)) return true;
+    for (I32 i = 0; i < autopilot.pressed_count; i++) {
+        if (autopilot.pressed[i] == key) return true;
     }
+    return false;
+}
 
-    if (player.active_spell != NO_SPELL) {
-        // Initial cast
-        if (!player.is_casting && 
-            player.mana >= SPELLS[player.active_spell].initial_cost &&
-            spellray_distance <= SPELLS[player.active_spell].activation_distance) {
-            player.is_casting = true;
-            player.mana -= SPELLS[player.active_spell].initial_cost;
-        }
+static void autopilot_hold(int key) {
+    if (autopilot.down_count < AUTOPILOT_MAX_KEYS) autopilot.down[autopilot.down_count++] = key;
+}
 
-        // Continue cast
-        if (player.is_casting) {
-            if (spellray_distance >= SPELLS[player.active_spell].activation_distance) {
-                player.is_casting = false;
-            }
+static void autopilot_press(int key) {
+    if (autopilot.pressed_count < AUTOPILOT_MAX_KEYS) autopilot.pressed[autopilot.pressed_count++] = key;
+}
 
-            F32 mana_cost = SPELLS[player.active_spell].cost_per_second * dt;
+static F32 distance_to_segment(Vec2 point, Vec2 a, Vec2 b) {
+    Vec2 ab = Vector2Subtract(b, a);
+    F32 length_sqr = Vector2DotProduct(ab, ab);
+    F32 t = (length_sqr > 0.0f) ? Clamp(Vector2DotProduct(Vector2Subtract(point, a), ab)/length_sqr, 0.0f, 1.0f) : 0.0f;
+    return Vector2Distance(point, Vector2Add(a, Vector2Scale(ab, t)));
+}
 
-            if (player.mana >= mana_cost) {
-                player.mana -= mana_cost;
-            } else {
-                player.is_casting = false;
-                player.active_spell = NO_SPELL;
-            }
-        }
+// Corners of the lap around the apprentice: leg 0 and 1 are the straight AUTOPILOT_LAP_OFFSET beside it,
+// leg 2 and 3 the way back AUTOPILOT_LAP_WIDTH further out
+static Vec2 autopilot_lap_corner(Vec2 anchor, I32 leg) {
+    F32 along = (leg == 1 || leg == 2) ? AUTOPILOT_LAP_AHEAD : -AUTOPILOT_LAP_BEHIND;
+    F32 across = AUTOPILOT_LAP_OFFSET + ((leg >= 2) ? AUTOPILOT_LAP_WIDTH : 0.0f);
+    return (Vec2){anchor.x + along, anchor.y + across};
+}
+
+// Direction to walk. The apprentice stays put as the ray's anchor and the player laps around beside it.
+// Enemies chase the player down the straight in a line and walk into the ray, the player waits at its
+// end and turns onto the way back once they close in. The way back is on the far side, so the crowd
+// cutting across never passes the apprentice. Nearby enemies and the map edges push away. Zero when nothing
+// pushes hard enough
+Vec2 steer_autopilot(void) {
+    Vec2 center = SPRITE_CENTER(player.pos);
+    Vec2 anchor = SPRITE_CENTER(apprentice.pos);
+    Vec2 steer = {0};
+
+    F32 nearest = map_width + map_height;
+    for (int i = 0; i < arrlen(enemies); i++) {
+        Vec2 away = Vector2Subtract(center, SPRITE_CENTER(enemies[i].pos));
+        F32 distance = Vector2Length(away);
+        nearest = fminf(nearest, distance);
+        if (distance >= AUTOPILOT_DANGER_RADIUS || distance <= 0.0f) continue;
+        steer = Vector2Add(steer, Vector2Scale(away, (1.0f - distance/AUTOPILOT_DANGER_RADIUS)/distance*AUTOPILOT_DANGER_WEIGHT));
     }
 
-    if (!player.is_casting) {
-        player.mana += player.mana_regen * dt;
-        player.mana = Clamp(player.mana, 0.0f, player.max_mana);
+    Vec2 to_goal = Vector2Subtract(autopilot_lap_corner(anchor, autopilot.lap_leg), center);
+    F32 goal_distance = Vector2Length(to_goal);
+    if ((autopilot.lap_leg == 1) ? (nearest < AUTOPILOT_HOLD_RADIUS) : (goal_distance <= AUTOPILOT_WAYPOINT_RADIUS)) {
+        autopilot.lap_leg = (autopilot.lap_leg + 1)%4;
+    } else if (goal_distance > AUTOPILOT_WAYPOINT_RADIUS) {
+        steer = Vector2Add(steer, Vector2Scale(to_goal, 1.0f/goal_distance));
+    }
 
-        if (player.active_spell != NO_SPELL && 
-            player.mana >= SPELLS[player.active_spell].initial_cost &&
-            spellray_distance <= SPELLS[player.active_spell].activation_distance) {
-            player.is_casting = true;
-            player.mana -= SPELLS[player.active_spell].initial_cost;
-        }
+    Vec2 map_center = {map_width/2.0f, map_height/2.0f};
+    Vec2 to_center = Vector2Subtract(map_center, center);
+    F32 edge = fmaxf(fabsf(to_center.x)/(map_width/2.0f), fabsf(to_center.y)/(map_height/2.0f));
+    if (edge > AUTOPILOT_EDGE_MARGIN) {
+        F32 push = (edge - AUTOPILOT_EDGE_MARGIN)/(1.0f - AUTOPILOT_EDGE_MARGIN)*AUTOPILOT_EDGE_WEIGHT;
+        steer = Vector2Add(steer, Vector2Scale(Vector2Normalize(to_center), push));
     }
 
-    // Apprentice
+    if (Vector2Length(steer) < AUTOPILOT_DEADZONE) return (Vec2){0};
+    return Vector2Normalize(steer);
+}
 
-    if (player.is_casting && player.active_spell == MANA_RAY) {
-        apprentice.mana += MANA_RAY_MANA_PER_SECOND * dt;
+// Runs before the screen update and decides this frame's keys. The death ray drains the apprentice, so
+// it switches to the mana ray while no enemy is near the ray or, failing that, below
+// AUTOPILOT_RECHARGE_BELOW, and back once the apprentice is full or enemies reach the ray
+void update_autopilot(void) {
+    autopilot.down_count = 0;
+    autopilot.pressed_count = 0;
+
+    if (current_screen == SCREEN_TITLE) {
+        autopilot.game_start = GetTime();
+        autopilot.lap_leg = 0;
+        autopilot_press(KEY_ENTER);
+        return;
+    }
+    if (current_screen == SCREEN_ENDING) {
+        autopilot.games++;
+        if (wave_id > autopilot.best_wave) autopilot.best_wave = wave_id;
+        TraceLog(LOG_INFO, "AUTOPILOT: Game %i over at wave %i after %.0f s", autopilot.games, wave_id,
+            GetTime() - autopilot.game_start);
+        autopilot_press(KEY_ENTER);
+        return;
+    }
+    if (gameplay_paused || game_over) return;
+
+    Vec2 steer = steer_autopilot();
+    if (steer.x < -AUTOPILOT_AXIS_THRESHOLD) autopilot_hold(KEY_A);
+    if (steer.x >  AUTOPILOT_AXIS_THRESHOLD) autopilot_hold(KEY_D);
+    if (steer.y < -AUTOPILOT_AXIS_THRESHOLD) autopilot_hold(KEY_W);
+    if (steer.y >  AUTOPILOT_AXIS_THRESHOLD) autopilot_hold(KEY_S);
+
+    if (apprentice.following_player) autopilot_press(KEY_F);
+
+    // A spell drops when the player runs out of mana. Casting again at the initial cost would drop it
+    // the next frame, so the bar refills first
+    if (player.active_spell == NO_SPELL && player.mana < player.max_mana*AUTOPILOT_CAST_ABOVE) return;
+
+    F32 nearest_to_ray = map_width + map_height;
+    for (int i = 0; i < arrlen(enemies); i++) {
+        F32 distance = distance_to_segment(SPRITE_CENTER(enemies[i].pos), player.ray_anchor, apprentice.ray_anchor);
+        nearest_to_ray = fminf(nearest_to_ray, distance);
+    }
+    bool charged = apprentice.mana > apprentice.max_mana*AUTOPILOT_RECHARGE_ABOVE;
+    if (apprentice.mana < apprentice.max_mana*AUTOPILOT_RECHARGE_BELOW) autopilot.recharging = true;
+    if (nearest_to_ray > AUTOPILOT_RAY_IDLE && !charged) autopilot.recharging = true;
+    if (charged) autopilot.recharging = false;
+    if (nearest_to_ray < AUTOPILOT_RAY_BUSY && apprentice.mana > apprentice.max_mana*AUTOPILOT_RECHARGE_BELOW) {
+        autopilot.recharging = false;
+    }
+    Spell_Kind spell = autopilot.recharging ? MANA_RAY : DEATH_RAY;
+    if (player.active_spell != spell) autopilot_press(spell == MANA_RAY ? KEY_E : KEY_R);
+}
+
+void start_stress_test(void) {
+    current_screen = SCREEN_GAMEPLAY;
+    arrsetlen(enemies, 0);
+    for (I32 i = 0; i < STRESS_STEP_COUNT; i++) stress.steps[i].enemies = STRESS_ENEMY_COUNTS[i];
+    stress.step = 0;
+    stress.step_start = GetTime();
+    TraceLog(LOG_INFO, "STRESS: %i enemies", stress.steps[0].enemies);
+}
+
+// Runs before update_gameplay(). Refills the enemies the death ray killed, a new step only adds more
+void update_stress_test(void) {
+    F64 now = GetTime();
+    Stress_Step *step = &stress.steps[stress.step];
+    if (now - stress.step_start >= STRESS_SETTLE_SECONDS + STRESS_HOLD_SECONDS && step->frames.count >= STRESS_MIN_FRAMES) {
+        TraceLog(LOG_INFO, "STRESS: %i enemies, avg %.2f ms, p99 %.2f ms, max %.2f ms", step->enemies,
+            step->frames.total_ms/step->frames.count, histogram_percentile(&step->frames, 99.0), step->frames.max_ms);
+        if (stress.step + 1 == STRESS_STEP_COUNT) {
+            save_stress_report(STRESS_REPORT_FILE);
+            stress.finished = true;
+            return;
+        }
+        stress.step++;
+        stress.step_start = now;
+        TraceLog(LOG_INFO, "STRESS: %i enemies", stress.steps[stress.step].enemies);
+    }
+
+    I32 missing = stress.steps[stress.step].enemies - (I32)arrlen(enemies);
+    for (I32 i = 0; i < missing; i++) {
+        // Golden angle steps never land two enemies on the same spot, stacked enemies separate into NaN
+        F32 angle = (F32)fmod(stress.spawned*STRESS_SPAWN_ANGLE, 2.0*PI);
+        Enemy enemy = {
+            .id = stress.spawned,
+            .alive = true,
+            .pos = (Vec2){
+                player.pos.x + STRESS_SPAWN_RADIUS*cosf(angle),
+                player.pos.y + STRESS_SPAWN_RADIUS*sinf(angle)},
+            .speed = balance.enemy_speed,
+
+            .health = 100.0f,
+            .max_health = 100.0f,
+            .anim = start_clip(CLIP_ENEMY_0_WALK + stress.spawned%4),
+        };
+        arrput(enemies, enemy);
+        stress.spawned++;
+    }
+    if (missing > 0) flight.current.counters.spawns += missing;
+
+    player.mana = player.max_mana;
+    apprentice.mana = apprentice.max_mana;
+    player.active_spell = DEATH_RAY;
+}
+
+void record_stress_frame(F32 frame_ms, F32 update_ms, F32 draw_ms) {
+    if (stress.finished || GetTime() - stress.step_start < STRESS_SETTLE_SECONDS) return;
+
+    Stress_Step *step = &stress.steps[stress.step];
+    histogram_add(&step->frames, frame_ms);
+    step->update_ms += update_ms;
+    step->separation_ms += enemy_grid.ms;
+    step->draw_ms += draw_ms;
+}
+
+void save_stress_report(const char *file_name) {
+    FILE *file = fopen(file_name, "w");
+    if (file == NULL) {
+        TraceLog(LOG_WARNING, "STRESS: Failed to open %s", file_name);
+        return;
+    }
+
+    fprintf(file, "enemies,frames,avg_ms,p99_ms,max_ms,update_avg_ms,separation_avg_ms,draw_avg_ms\n");
+    for (I32 i = 0; i < STRESS_STEP_COUNT; i++) {
+        const Stress_Step *step = &stress.steps[i];
+        U32 frames = step->frames.count;
+        if (frames == 0) continue;
+        fprintf(file, "%i,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", step->enemies, frames, step->frames.total_ms/frames,
+            histogram_percentile(&step->frames, 99.0), step->frames.max_ms, step->update_ms/frames,
+            step->separation_ms/frames, step->draw_ms/frames);
+    }
+    fclose(file);
+    TraceLog(LOG_INFO, "STRESS: Report written to %s", file_name);
+}
+
+U32 render_graph_draw_calls(void) {
+    U32 draw_calls = 0;
+    for (I32 i = 0; i < PASS_COUNT; i++) {
+        if (!render_graph.stats[i].culled) draw_calls += render_graph.stats[i].draw_calls;
+    }
+    return draw_calls;
+}
+
+// Commits the frame that started at the previous call and begins the next one
+void record_flight_frame(F64 frame_start) {
+    Flight_Frame *frame = &flight.current;
+
+    if (flight.last_start > 0.0) {
+        frame->frame_ms = (F32)((frame_start - flight.last_start)*1000.0);
+        frame->particles = particles.count;
+        frame->enemies = (U16)arrlen(enemies);
+        frame->wave_id = (I16)wave_id;
+        frame->screen = (U8)current_screen;
+        frame->draw_calls = render_graph_draw_calls();
+        for (I32 i = 0; i < PASS_COUNT; i++) {
+            frame->pass_ms[i] = render_graph.stats[i].culled ? 0.0f : render_graph.stats[i].cpu_ms;
+        }
+        // Same rule as the frame stats, a frame ending on a static screen is followed by an idle wait
+        frame->hitch = !flight.skip_next && !is_static_frame() && frame->frame_ms > flight.threshold_ms;
+
+        flight.frames[flight.count++ % FLIGHT_RECORDER_FRAMES] = *frame;
+        flight.skip_next = false;
+
+        if (flight.dump_countdown > 0) {
+            if (--flight.dump_countdown == 0) {
+                dump_flight_recorder(TextFormat(HITCH_FILE_FORMAT, flight.dumps++));
+                flight.skip_next = true;
+            }
+        } else if (frame->hitch) {
+            flight.dump_countdown = FLIGHT_RECORDER_AFTER_FRAMES;
+        }
+    }
+
+    flight.last_start = frame_start;
+    *frame = (Flight_Frame){ .frame = flight.count, .time = (F32)frame_start };
+}
+
+// Times a section of the frame in progress, returns its end as the start of the next one
+F64 end_flight_section(Flight_Section section, F64 start) {
+    F64 now = GetTime();
+    flight.current.section_ms[section] = (F32)((now - start)*1000.0);
+    return now;
+}
+
+// One CSV row per recorded frame, oldest first
+void dump_flight_recorder(const char *file_name) {
+    FILE *file = fopen(file_name, "w");
+    if (file == NULL) {
+        TraceLog(LOG_WARNING, "FLIGHT RECORDER: Failed to open %s", file_name);
+        return;
+    }
+
+    fprintf(file, "frame,time,frame_ms,music_ms,update_ms,draw_ms,present_ms,pace_ms");
+    for (I32 i = 0; i < PASS_COUNT; i++) fprintf(file, ",%s_ms", RENDER_PASS_NAMES[i]);
+    fprintf(file, ",draw_calls,particles,enemies,wave,screen,deaths,spawns,sounds,allocations,hitch\n");
+
+    U32 first = flight.count > FLIGHT_RECORDER_FRAMES ? flight.count - FLIGHT_RECORDER_FRAMES : 0;
+    for (U32 i = first; i < flight.count; i++) {
+        const Flight_Frame *frame = &flight.frames[i % FLIGHT_RECORDER_FRAMES];
+        fprintf(file, "%u,%.4f,%.3f", frame->frame, frame->time, frame->frame_ms);
+        for (I32 j = 0; j < FLIGHT_SECTION_COUNT; j++) fprintf(file, ",%.3f", frame->section_ms[j]);
+        for (I32 j = 0; j < PASS_COUNT; j++) fprintf(file, ",%.3f", frame->pass_ms[j]);
+        fprintf(file, ",%u,%u,%u,%i,%u,%u,%u,%u,%u,%i\n", frame->draw_calls, frame->particles, frame->enemies,
+            frame->wave_id, frame->screen, frame->counters.deaths, frame->counters.spawns, frame->counters.sounds,
+            frame->counters.allocations, frame->hitch);
+    }
+    fclose(file);
+
+    TraceLog(LOG_INFO, "FLIGHT RECORDER: Hitch dumped to %s", file_name);
+}
+
+void play_sound(Sound sound) {
+    PlaySound(sound);
+    flight.current.counters.sounds++;
+}
+
+static void *track_allocation(void *block, size_t size, Alloc_Tag tag) {
+    if (block == NULL) return NULL;
+
+    Alloc_Header *header = block;
+    *header = (Alloc_Header){ size, tag };
+
+    Alloc_Stats *stats = &allocs.tags[tag];
+    stats->live_bytes += size;
+    if (stats->live_bytes > stats->peak_bytes) stats->peak_bytes = stats->live_bytes;
+    stats->allocations++;
+    stats->frame_allocations++;
+    allocs.live_bytes += size;
+    if (allocs.live_bytes > allocs.peak_bytes) allocs.peak_bytes = allocs.live_bytes;
+    flight.current.counters.allocations++;
+    return header + 1;
+}
+
+static void untrack_allocation(Alloc_Header *header) {
+    allocs.tags[header->tag].live_bytes -= header->size;
+    allocs.live_bytes -= header->size;
+}
+
+// Every block carries an Alloc_Header with its size and tag, so frees are charged to the
+// part of the game that allocated. RL_* and STBDS_* in this file are defined to these
+void *tracked_malloc(size_t size) {
+    return track_allocation(malloc(sizeof(Alloc_Header) + size), size, allocs.tag);
+}
+
+void *tracked_calloc(size_t count, size_t size) {
+    return track_allocation(calloc(1, sizeof(Alloc_Header) + count*size), count*size, allocs.tag);
+}
+
+// A grown block stays with the tag it was first allocated under
+void *tracked_realloc(void *ptr, size_t size) {
+    if (ptr == NULL) return tracked_malloc(size);
+
+    Alloc_Header *header = (Alloc_Header *)ptr - 1;
+    Alloc_Tag tag = (Alloc_Tag)header->tag;
+    Alloc_Header old = *header;
+    void *block = realloc(header, sizeof(Alloc_Header) + size);
+    if (block == NULL) return NULL;
+
+    untrack_allocation(&old);
+    return track_allocation(block, size, tag);
+}
+
+void tracked_free(void *ptr) {
+    if (ptr == NULL) return;
+
+    Alloc_Header *header = (Alloc_Header *)ptr - 1;
+    untrack_allocation(header);
+    free(header);
+}
+
+// Returns the previous tag, to restore it after a scope
+Alloc_Tag set_alloc_tag(Alloc_Tag tag) {
+    Alloc_Tag previous = allocs.tag;
+    allocs.tag = tag;
+    return previous;
+}
+
+// Called at the start of a frame, closes the per-frame counts of the previous one
+void end_alloc_frame(void) {
+    U32 frame_allocations = 0;
+    for (I32 i = 0; i < ALLOC_TAG_COUNT; i++) {
+        frame_allocations += allocs.tags[i].frame_allocations;
+        allocs.tags[i].last_frame_allocations = allocs.tags[i].frame_allocations;
+        allocs.tags[i].frame_allocations = 0;
+    }
+    if (!is_static_frame()) {
+        allocs.gameplay_frames++;
+        if (frame_allocations > 0) allocs.allocating_frames++;
+    }
+}
+
+void draw_memory_stats(int x, int y) {
+    draw_text(TextFormat("Game heap: %.1f KB, peak %.1f KB, %u/%u frames allocated", allocs.live_bytes/1024.0,
+        allocs.peak_bytes/1024.0, allocs.allocating_frames, allocs.gameplay_frames), x, y, 10, PAL4);
+    for (I32 i = 0; i < ALLOC_TAG_COUNT; i++) {
+        Alloc_Stats stats = allocs.tags[i];
+        draw_text(TextFormat("%-10s %8.1f KB %8.1f peak %3u/f", ALLOC_TAG_NAMES[i], stats.live_bytes/1024.0,
+            stats.peak_bytes/1024.0, stats.last_frame_allocations), x, y + 12 + i*12, 10, PAL4);
+    }
+}
+
+// Logged on exit after everything is freed, live bytes left are leaks
+void report_allocations(void) {
+    TraceLog(LOG_INFO, "MEMORY: Game heap peak %.1f KB, %u of %u gameplay frames allocated", allocs.peak_bytes/1024.0,
+        allocs.allocating_frames, allocs.gameplay_frames);
+    for (I32 i = 0; i < ALLOC_TAG_COUNT; i++) {
+        Alloc_Stats stats = allocs.tags[i];
+        TraceLog(stats.live_bytes != 0 ? LOG_WARNING : LOG_INFO, "MEMORY:     %-10s %6u allocations, peak %8.1f KB, %lld bytes leaked",
+            ALLOC_TAG_NAMES[i], stats.allocations, stats.peak_bytes/1024.0, (long long)stats.live_bytes);
+    }
+}
+
+void start_trace(const char *file_name) {
+    tracer.file = fopen(file_name, "w");
+    if (tracer.file == NULL) {
+        TraceLog(LOG_WARNING, "TRACE: Failed to open %s", file_name);
+        return;
+    }
+
+    tracer.enabled = true;
+    tracer.origin = GetTime();
+    tracer.count = 0;
+    tracer.written = 0;
+    tracer.dropped = 0;
+
+    fprintf(tracer.file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    fprintf(tracer.file, "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"main\"}}");
+    TraceLog(LOG_INFO, "TRACE: Recording to %s", file_name);
+}
+
+void stop_trace(void) {
+    flush_trace();
+    fprintf(tracer.file, "\n]}\n");
+    fclose(tracer.file);
+    tracer.file = NULL;
+    tracer.enabled = false;
+    TraceLog(LOG_INFO, "TRACE: Wrote %u zones, dropped %u", tracer.written, tracer.dropped);
+}
+
+// Zones still open are not written, flushing only happens between frames
+void flush_trace(void) {
+    for (I32 i = 0; i < tracer.count; i++) {
+        Trace_Event event = tracer.events[i];
+        if (event.end < event.start) continue;
+        fprintf(tracer.file, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": %.3f, \"dur\": %.3f}",
+            event.name, (event.start - tracer.origin)*1e6, (event.end - event.start)*1e6);
+        tracer.written++;
+    }
+    tracer.count = 0;
+}
+
+// Called at the start of a frame, no zone is open
+void update_tracer(void) {
+    if (tracer.toggle) {
+        tracer.toggle = false;
+        if (tracer.enabled) stop_trace();
+        else start_trace(TextFormat(TRACE_FILE_FORMAT, tracer.captures++));
+    }
+    if (tracer.enabled && tracer.count > TRACE_MAX_EVENTS - TRACE_FRAME_HEADROOM) flush_trace();
+}
+
+// Returns the zone to pass to trace_end(), only a branch while tracing is off
+I32 trace_begin(const char *name) {
+    if (!tracer.enabled) return -1;
+    if (tracer.count == TRACE_MAX_EVENTS) {
+        tracer.dropped++;
+        return -1;
+    }
+
+    I32 zone = tracer.count++;
+    tracer.events[zone] = (Trace_Event){ name, GetTime(), -1.0 };
+    return zone;
+}
+
+void trace_end(I32 zone) {
+    if (zone < 0 || !tracer.enabled) return;
+    tracer.events[zone].end = GetTime();
+}
+
+static void pass_world(void) {
+    ClearBackground(BLANK);
+    draw_gameplay();
+}
+
+// Composites the light buffer over the world, upscaled by the bilinear filter
+static void pass_light_composite(void) {
+    BeginBlendMode(BLEND_MULTIPLIED);
+        DrawTexturePro(lights.texture.texture,
+            (Rect){0, 0, (F32)lights.texture.texture.width, -(F32)lights.texture.texture.height},
+            (Rect){0, 0, (F32)target.texture.width, (F32)target.texture.height},
+            (Vec2){0, 0}, 0.0f, WHITE);
+    EndBlendMode();
+}
+
+// Draws the world target to the screen, upscaled from the dynamic resolution size
+static void pass_present(void) {
+    begin_post_composite();
+    DrawTexturePro(target.texture,
+        (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height },
+        (Rectangle){ 0, 0, (float)screenWidth, (float)screenHeight },
+        (Vector2){ 0, 0 },
+        0.0f,
+        WHITE);
+    end_post_composite();
+}
+
+static void pass_title(void) {
+    Atlas_Sprite howto = ATLAS_SPRITES[SPRITE_HOWTO];
+    draw_sprite_frame(SPRITE_HOWTO, PALETTE_ROW_BASE, (Rect){TILE_SIZE, 0, howto.frame.x*3, howto.frame.y*3}, NO_FLIP, 0.0f, WHITE);
+}
+
+static void pass_ending(void) {
+    const char *text = "GAME OVER";
+    F32 fontsize = 40;
+    int font_width = measure_text(text, fontsize);
+    draw_text(text, screenWidth/2 - font_width/2, screenHeight/2 - fontsize/2, fontsize, PAL2);
+}
+
+// Declares this frame's passes. Passes are added for the content they have, the graph culls
+// whatever ends up not reaching the backbuffer (the world chain outside of gameplay, bloom when disabled)
+void build_render_graph(void) {
+    render_graph.count = 0;
+    render_graph.persistent = 0;
+    U32 bloom = post.enabled[POST_BLOOM] ? RESOURCE_BLOOM : 0;
+
+    if (current_screen == SCREEN_GAMEPLAY && gameplay_paused) {
+        // Frozen snapshot: the world target and bloom pyramid still hold the last gameplay frame
+        render_graph.persistent = RESOURCE_WORLD | RESOURCE_BLOOM;
+    } else {
+        add_render_pass(PASS_DECALS, 0, RESOURCE_DECALS, RENDER_TARGET_NONE, false, bake_decals);
+        add_render_pass(PASS_LIGHTS, 0, RESOURCE_LIGHTS, RENDER_TARGET_NONE, false, render_lights);
+        if (current_screen == SCREEN_GAMEPLAY) {
+            add_render_pass(PASS_WORLD, RESOURCE_DECALS, RESOURCE_WORLD, RENDER_TARGET_WORLD, false, pass_world);
+        }
+        add_render_pass(PASS_LIGHT_COMPOSITE, RESOURCE_WORLD | RESOURCE_LIGHTS, RESOURCE_WORLD, RENDER_TARGET_WORLD, false, pass_light_composite);
+        add_render_pass(PASS_BLOOM, RESOURCE_WORLD, RESOURCE_BLOOM, RENDER_TARGET_NONE, false, render_bloom);
+    }
+    add_render_pass(PASS_PRESENT, RESOURCE_WORLD | bloom, RESOURCE_BACKBUFFER, RENDER_TARGET_BACKBUFFER, false, pass_present);
+
+    if (current_screen == SCREEN_TITLE) {
+        add_render_pass(PASS_TITLE, 0, RESOURCE_BACKBUFFER, RENDER_TARGET_BACKBUFFER, true, pass_title);
+    }
+    if (current_screen == SCREEN_GAMEPLAY) {
+        add_render_pass(PASS_HUD, 0, RESOURCE_BACKBUFFER, RENDER_TARGET_BACKBUFFER, true, draw_ui);
+        if (should_draw_debug_ui) {
+            add_render_pass(PASS_DEBUG, 0, RESOURCE_BACKBUFFER, RENDER_TARGET_BACKBUFFER, true, draw_debug_ui);
+        }
+    }
+    if (current_screen == SCREEN_ENDING) {
+        add_render_pass(PASS_ENDING, 0, RESOURCE_BACKBUFFER, RENDER_TARGET_BACKBUFFER, true, pass_ending);
+    }
+}
+
+void add_render_pass(Render_Pass_Id id, U32 reads, U32 writes, Render_Target target, bool palette, void (*execute)(void)) {
+    if (render_graph.count >= PASS_COUNT) return;
+    render_graph.passes[render_graph.count++] = (Render_Pass){
+        .id      = id,
+        .reads   = reads,
+        .writes  = writes,
+        .target  = target,
+        .palette = palette,
+        .execute = execute,
+    };
+}
+
+// Culls passes missing an input or whose outputs nobody reads, then merges neighbouring
+// passes that bind the same target and shader
+void cull_render_graph(void) {
+    Render_Pass *passes = render_graph.passes;
+    I32 count = render_graph.count;
+
+    // Forward: every input has to be written by an earlier pass or kept from an earlier frame
+    U32 available = render_graph.persistent;
+    for (I32 i = 0; i < count; i++) {
+        passes[i].culled = (passes[i].reads & ~available) != 0;
+        if (!passes[i].culled) available |= passes[i].writes;
+    }
+
+    // Backward: keep what reaches the backbuffer
+    U32 needed = RESOURCE_BACKBUFFER;
+    for (I32 i = count - 1; i >= 0; i--) {
+        if (passes[i].culled) continue;
+        if ((passes[i].writes & needed) == 0) {
+            passes[i].culled = true;
+            continue;
+        }
+        needed |= passes[i].reads;
+    }
+
+    render_graph.groups = 0;
+    Render_Pass *previous = NULL;
+    for (I32 i = 0; i < count; i++) {
+        Render_Pass *pass = &passes[i];
+        if (pass->culled) continue;
+
+        bool merges = (previous != NULL) && (pass->target != RENDER_TARGET_NONE) &&
+            (pass->target == previous->target) && (pass->palette == previous->palette);
+        pass->opens_group = !merges;
+        pass->closes_group = true;
+        if (merges) previous->closes_group = false;
+        if (!merges) render_graph.groups++;
+        previous = pass;
+    }
+}
+
+void execute_render_graph(void) {
+    cull_render_graph();
+    read_gpu_timers();
+    render_graph.presenting = false;
+
+    for (I32 i = 0; i < PASS_COUNT; i++) {
+        render_graph.stats[i] = (Render_Pass_Stats){ .culled = true };
+    }
+
+    for (I32 i = 0; i < render_graph.count; i++) {
+        Render_Pass *pass = &render_graph.passes[i];
+        if (pass->culled) continue;
+
+        F64 start = GetTime();
+        U32 draw_calls = draw_call_count;
+        U32 vertices = vertex_count;
+        U32 texture_binds = texture_bind_count;
+        I32 zone = trace_begin(RENDER_PASS_NAMES[pass->id]);
+
+        if (pass->opens_group) {
+            begin_gpu_timer(pass->id);
+            if (pass->target == RENDER_TARGET_BACKBUFFER && !render_graph.presenting) {
+                BeginDrawing();
+                ClearBackground(PAL5);
+                render_graph.presenting = true;
+            }
+            if (pass->target == RENDER_TARGET_WORLD) BeginTextureMode(target);
+            if (pass->palette) BeginShaderMode(palette_lookup.shader);
+        }
+
+        pass->execute();
+
+        if (pass->closes_group) {
+            flush_render_batch();
+            if (pass->palette) EndShaderMode();
+            if (pass->target == RENDER_TARGET_WORLD) EndTextureMode();
+            end_gpu_timer();
+        }
+        trace_end(zone);
+
+        render_graph.stats[pass->id] = (Render_Pass_Stats){
+            .culled        = false,
+            .cpu_ms        = (F32)((GetTime() - start)*1000.0),
+            .gpu_ms        = pass->opens_group ? gpu_timers.gpu_ms[pass->id] : 0.0f,
+            .gpu_timed     = pass->opens_group && gpu_timers.supported,
+            .draw_calls    = draw_call_count - draw_calls,
+            .vertices      = vertex_count - vertices,
+            .texture_binds = texture_bind_count - texture_binds,
+        };
+    }
+
+    // Nothing was drawn to the screen, still present a cleared frame
+    if (!render_graph.presenting) {
+        BeginDrawing();
+        ClearBackground(PAL5);
+        render_graph.presenting = true;
+    }
+}
+
+#if defined(COUNT_DRAW_CALLS)
+typedef void (GL_CALL *Gl_Draw_Elements)(unsigned int mode, int count, unsigned int type, const void *indices);
+typedef void (GL_CALL *Gl_Draw_Arrays)(unsigned int mode, int first, int count);
+typedef void (GL_CALL *Gl_Bind_Texture)(unsigned int target, unsigned int texture);
+
+// Defined by the glad loader compiled into raylib
+extern Gl_Draw_Elements glad_glDrawElements;
+extern Gl_Draw_Arrays glad_glDrawArrays;
+extern Gl_Bind_Texture glad_glBindTexture;
+
+static Gl_Draw_Elements gl_draw_elements = NULL;
+static Gl_Draw_Arrays gl_draw_arrays = NULL;
+static Gl_Bind_Texture gl_bind_texture = NULL;
+
+// rlgl draws its batches as indexed quads, six indices for four vertices
+static void GL_CALL counting_draw_elements(unsigned int mode, int count, unsigned int type, const void *indices) {
+    draw_call_count++;
+    vertex_count += count/6*4;
+    gl_draw_elements(mode, count, type, indices);
+}
+
+static void GL_CALL counting_draw_arrays(unsigned int mode, int first, int count) {
+    draw_call_count++;
+    vertex_count += count;
+    gl_draw_arrays(mode, first, count);
+}
+
+static void GL_CALL counting_bind_texture(unsigned int target, unsigned int texture) {
+    texture_bind_count++;
+    gl_bind_texture(target, texture);
+}
+#else
+// Set active instead of raylib's default batch, which rlgl doesn't expose
+static rlRenderBatch render_batch = { 0 };
+#endif
+
+// With USE_GLAD_HOOKS, wraps the GL draw and texture bind entry points so everything rlgl issues is
+// counted. Otherwise the game owns the active batch and flush_render_batch() counts its draws
+void install_draw_call_counter(void) {
+#if defined(COUNT_DRAW_CALLS)
+    if (gl_draw_elements != NULL) return;
+    gl_draw_elements = glad_glDrawElements;
+    gl_draw_arrays = glad_glDrawArrays;
+    gl_bind_texture = glad_glBindTexture;
+    glad_glDrawElements = counting_draw_elements;
+    glad_glDrawArrays = counting_draw_arrays;
+    glad_glBindTexture = counting_bind_texture;
+#else
+    if (render_batch.draws != NULL) return;
+    render_batch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    rlSetRenderBatchActive(&render_batch);
+#endif
+}
+
+void uninstall_draw_call_counter(void) {
+#if !defined(COUNT_DRAW_CALLS)
+    if (render_batch.draws == NULL) return;
+    rlSetRenderBatchActive(NULL);           // Back to raylib's default batch
+    rlUnloadRenderBatch(render_batch);
+    render_batch = (rlRenderBatch){ 0 };
+#endif
+}
+
+// Flush points owned by the render graph go through here. Without the glad hooks the batch's pending
+// draws are counted first, a bind is a texture change between draws. Flushes raylib does by itself
+// inside a pass, on a shader, blend or texture mode change or a full batch, aren't seen, so those
+// counts are a lower bound
+void flush_render_batch(void) {
+#if !defined(COUNT_DRAW_CALLS)
+    unsigned int texture = 0;
+    for (I32 i = 0; i < render_batch.drawCounter; i++) {
+        rlDrawCall *draw = &render_batch.draws[i];
+        if (draw->vertexCount == 0) continue;
+        draw_call_count++;
+        vertex_count += draw->vertexCount;
+        if (draw->textureId != texture) texture_bind_count++;
+        texture = draw->textureId;
+    }
+#endif
+    rlDrawRenderBatchActive();
+}
+
+#if defined(GPU_TIMERS)
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+
+typedef void (GL_CALL *Gl_Gen_Queries)(int n, unsigned int *ids);
+typedef void (GL_CALL *Gl_Delete_Queries)(int n, const unsigned int *ids);
+typedef void (GL_CALL *Gl_Begin_Query)(unsigned int target, unsigned int id);
+typedef void (GL_CALL *Gl_End_Query)(unsigned int target);
+typedef void (GL_CALL *Gl_Get_Query_Object_Iv)(unsigned int id, unsigned int pname, int *params);
+typedef void (GL_CALL *Gl_Get_Query_Object_Ui64v)(unsigned int id, unsigned int pname, U64 *params);
+
+// Core since GL 3.3, NULL when raylib runs an older context
+extern Gl_Gen_Queries glad_glGenQueries;
+extern Gl_Delete_Queries glad_glDeleteQueries;
+extern Gl_Begin_Query glad_glBeginQuery;
+extern Gl_End_Query glad_glEndQuery;
+extern Gl_Get_Query_Object_Iv glad_glGetQueryObjectiv;
+extern Gl_Get_Query_Object_Ui64v glad_glGetQueryObjectui64v;
+#endif
+
+void init_gpu_timers(void) {
+#if defined(GPU_TIMERS)
+    if (glad_glGenQueries == NULL || glad_glGetQueryObjectui64v == NULL) {
+        TraceLog(LOG_WARNING, "GPU TIMERS: Timer queries not available, GPU times stay at 0");
+        return;
+    }
+    glad_glGenQueries(GPU_TIMER_FRAMES*PASS_COUNT, &gpu_timers.queries[0][0]);
+    gpu_timers.supported = true;
+#endif
+}
+
+void unload_gpu_timers(void) {
+#if defined(GPU_TIMERS)
+    if (gpu_timers.supported) glad_glDeleteQueries(GPU_TIMER_FRAMES*PASS_COUNT, &gpu_timers.queries[0][0]);
+    gpu_timers.supported = false;
+#endif
+}
+
+// Collects the queries issued GPU_TIMER_FRAMES frames ago, before their set is reused.
+// A result that isn't ready yet is dropped, the last one of that group is kept
+void read_gpu_timers(void) {
+#if defined(GPU_TIMERS)
+    if (!gpu_timers.supported) return;
+
+    gpu_timers.frame++;
+    U32 set = gpu_timers.frame%GPU_TIMER_FRAMES;
+    for (I32 i = 0; i < PASS_COUNT; i++) {
+        if (!gpu_timers.issued[set][i]) continue;
+        gpu_timers.issued[set][i] = false;
+
+        int available = 0;
+        glad_glGetQueryObjectiv(gpu_timers.queries[set][i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) continue;
+
+        U64 nanoseconds = 0;
+        glad_glGetQueryObjectui64v(gpu_timers.queries[set][i], GL_QUERY_RESULT, &nanoseconds);
+        gpu_timers.gpu_ms[i] = (F32)(nanoseconds/1e6);
+    }
+#endif
+}
+
+// Times one bind group. Groups start and end on batch flushes, so the queries don't split batches
+void begin_gpu_timer(Render_Pass_Id group) {
+#if defined(GPU_TIMERS)
+    if (!gpu_timers.supported) return;
+
+    U32 set = gpu_timers.frame%GPU_TIMER_FRAMES;
+    flush_render_batch();
+    glad_glBeginQuery(GL_TIME_ELAPSED, gpu_timers.queries[set][group]);
+    gpu_timers.issued[set][group] = true;
+#endif
+}
+
+void end_gpu_timer(void) {
+#if defined(GPU_TIMERS)
+    if (!gpu_timers.supported) return;
+
+    flush_render_batch();           // Passes without a target may leave their last draws batched
+    glad_glEndQuery(GL_TIME_ELAPSED);
+#endif
+}
+
+// Splits a frame's cost into the part that follows the world target size and the part that doesn't.
+// With GPU timers it is the GPU time of the groups drawing at the world scale, world target, light
+// buffer and bloom pyramid, against the rest of the GPU frame. Without, it is the CPU side:
+// present, where the driver blocks on the GPU's fill work, against update and draw submission.
+// With vsync present also blocks until the vblank, which no resolution shortens, and the two can't
+// be told apart without timers, so nothing counts as scaled and the scale only goes back up.
+// Pacer sleep is left out, it pads every frame to the budget
+void split_frame_cost(F32 cpu_ms, F32 present_ms, bool gpu_timed, bool vsync, F32 *scaled_ms, F32 *fixed_ms) {
+    *scaled_ms = vsync ? 0.0f : present_ms;
+    *fixed_ms = cpu_ms;
+    if (gpu_timed) {
+        *scaled_ms = 0.0f;
+        *fixed_ms = 0.0f;
+        for (I32 i = 0; i < PASS_COUNT; i++) {
+            bool scaled = (i == PASS_LIGHTS) || (i == PASS_WORLD) || (i == PASS_LIGHT_COMPOSITE) || (i == PASS_BLOOM);
+            if (scaled) *scaled_ms += render_graph.stats[i].gpu_ms;
+            else *fixed_ms += render_graph.stats[i].gpu_ms;
+        }
+    }
+}
+
+// Smooths the frame cost into state and returns the scale to draw at, only touches state
+F32 step_dynamic_resolution(Dynamic_Resolution *state, F32 dt, F32 scaled_ms, F32 fixed_ms) {
+    state->scaled_ms = Lerp(state->scaled_ms, scaled_ms, DYNRES_SMOOTHING);
+    state->fixed_ms = Lerp(state->fixed_ms, fixed_ms, DYNRES_SMOOTHING);
+    F32 frame_ms = state->fixed_ms + state->scaled_ms;
+
+    if (state->cooldown > 0.0f) {
+        state->cooldown -= dt;
+        return state->scale;
+    }
+
+    F32 new_scale = state->scale;
+    if (frame_ms > DYNRES_BUDGET_MS*DYNRES_HIGH_WATERMARK) {
+        state->over_budget_time += dt;
+        state->under_budget_time = 0.0f;
+        // A frame bound by the fixed part, e.g. gameplay update, gains nothing from fewer pixels
+        bool fill_bound = state->scaled_ms >= frame_ms*DYNRES_MIN_SCALED_SHARE;
+        if (fill_bound && (state->over_budget_time >= DYNRES_DOWNSCALE_DELAY)) new_scale -= DYNRES_SCALE_STEP;
+    } else if (frame_ms < DYNRES_BUDGET_MS*DYNRES_LOW_WATERMARK) {
+        state->under_budget_time += dt;
+        state->over_budget_time = 0.0f;
+        if (state->under_budget_time >= DYNRES_UPSCALE_DELAY) {
+            // Only step up if the predicted cost of the bigger target stays under the high watermark,
+            // otherwise we would immediately step down again. Only the scaled part grows with the area
+            F32 up_scale = state->scale + DYNRES_SCALE_STEP;
+            F32 area_ratio = (up_scale*up_scale)/(state->scale*state->scale);
+            F32 predicted_ms = state->fixed_ms + state->scaled_ms*area_ratio;
+            if (predicted_ms < DYNRES_BUDGET_MS*DYNRES_HIGH_WATERMARK) new_scale = up_scale;
+        }
+    } else {
+        state->over_budget_time = 0.0f;
+        state->under_budget_time = 0.0f;
+    }
+
+    new_scale = Clamp(new_scale, DYNRES_MIN_SCALE, DYNRES_MAX_SCALE);
+    if (new_scale != state->scale) {
+        state->scale = new_scale;
+        state->over_budget_time = 0.0f;
+        state->under_budget_time = 0.0f;
+        state->cooldown = DYNRES_COOLDOWN;
+    }
+    return new_scale;
+}
+
+void update_dynamic_resolution(F32 cpu_ms, F32 present_ms) {
+    F32 scaled_ms = 0.0f;
+    F32 fixed_ms = 0.0f;
+    split_frame_cost(cpu_ms, present_ms, gpu_timers.supported, pacer.mode == PACER_VSYNC, &scaled_ms, &fixed_ms);
+
+    F32 old_scale = dynres.scale;
+    if (step_dynamic_resolution(&dynres, frame_dt, scaled_ms, fixed_ms) == old_scale) return;
+
+    UnloadRenderTexture(target);
+    target = LoadRenderTexture((int)(screenWidth*dynres.scale), (int)(screenHeight*dynres.scale));
+    SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
+    resize_light_buffer();
+    resize_bloom_pyramid();
+    // Particles are fill too, keep their count in proportion to the pixels drawn
+    set_particle_limit((I32)(particles.capacity*dynres.scale*dynres.scale));
+    TraceLog(LOG_INFO, "Render scale changed to %d%%", (int)(dynres.scale*100.0f));
+}
+
+// Feeds DYNRES_CHECK_SECONDS of made up frames through the scale logic and warns if it picks the
+// wrong scale: an idle frame blocked on vsync in present must stay at full resolution, a free run
+// frame blocked on fill work in present must step down. Run at startup in debug builds
+bool check_dynamic_resolution(void) {
+    const F32 dt = 1.0f/PACER_TARGET_FPS;
+    Dynamic_Resolution idle_vsync = { .scale = DYNRES_MAX_SCALE };
+    Dynamic_Resolution fill_bound = { .scale = DYNRES_MAX_SCALE };
+    for (F32 time = 0.0f; time < DYNRES_CHECK_SECONDS; time += dt) {
+        F32 scaled_ms = 0.0f;
+        F32 fixed_ms = 0.0f;
+        split_frame_cost(1.0f, DYNRES_BUDGET_MS - 1.0f, false, true, &scaled_ms, &fixed_ms);
+        step_dynamic_resolution(&idle_vsync, dt, scaled_ms, fixed_ms);
+        split_frame_cost(1.0f, DYNRES_BUDGET_MS, false, false, &scaled_ms, &fixed_ms);
+        step_dynamic_resolution(&fill_bound, dt, scaled_ms, fixed_ms);
+    }
+
+    bool passed = (idle_vsync.scale == DYNRES_MAX_SCALE) && (fill_bound.scale < DYNRES_MAX_SCALE);
+    if (!passed) {
+        TraceLog(LOG_WARNING, "DYNRES: Check failed, idle vsync frame at %d%%, fill bound frame at %d%%",
+            (int)(idle_vsync.scale*100.0f), (int)(fill_bound.scale*100.0f));
+    }
+    return passed;
+}
+
+// Camera used for the world target, zoomed down together with the dynamic resolution scale
+Camera2D get_world_camera(void) {
+    Camera2D world_camera = camera;
+    world_camera.offset = Vector2Scale(camera.offset, dynres.scale);
+    world_camera.zoom   = camera.zoom*dynres.scale;
+    return world_camera;
+}
+
+void init_gameplay(void) {
+    player = (Player){
+        .pos = (Vec2){map_height/2.0f - TILE_SIZE/2, map_width/2.0f - TILE_SIZE/2},
+        .speed = TILE_SIZE*3,
+
+        .health = 100.0f,
+        .max_health = 100.0f,
+        .is_invincible = false,
+        .invincibility_timer = 5.0f, 
+
+        .mana = 100.0f,
+        .max_mana = 100.0f,
+        .mana_regen = 10.0f,
+
+        .anim = start_clip(CLIP_PLAYER_IDLE),
+    };
+
+    apprentice = (Apprentice) {
+        .pos = (Vec2){map_width/2.0f - TILE_SIZE/2 - 30, map_height/2.0f - TILE_SIZE/2 - 30},
+        .speed = TILE_SIZE*2.8f,
+        .following_player = true,
+
+        .health = 100.0f,
+        .max_health = 100.0f,
+        .is_invincible = false,
+        .invincibility_timer = 5.0f, 
+
+        .mana = 0.0f,
+        .max_mana = 100.0f,
+        .mana_regen = 1.0f,
+
+        .anim = start_clip(CLIP_APPRENTICE_IDLE),
+    };
+
+    arrsetlen(dying_enemies, 0);
+    particles.count = 0;
+    arrsetlen(decals.pending, 0);
+    decals.clear = true;
+    decals.fade_steps = 0;
+
+    wave_id = 1;
+    int number_of_enemies = 2;
+    for (int i = 0; i < number_of_enemies; i++) {
+        F32 angle = (2.0f * PI * i) / number_of_enemies;
+        F32 radius = 500.0f;
+        Enemy enemy = {
+            .id = i,
+            .alive = true,
+            .pos = (Vec2){
+                (F32)map_width/2  + radius * cosf(angle),
+                (F32)map_height/2 + radius * sinf(angle)},
+            .speed = balance.enemy_speed,
+
+            .health = 100.0f,
+            .max_health = 100.0f,
+            .anim = start_clip(CLIP_ENEMY_0_WALK + i%4),
+        };
+        arrput(enemies, enemy);
+    }
+
+}
+
+void update_gameplay(void) {
+    I32 update_zone = trace_begin("update_gameplay");
+    F32 dt = frame_dt;
+    frames_counter = 0;
+    frames_counter++;
+
+    if (IsKeyPressed(KEY_TAB)) {
+        const char* text = should_draw_debug_ui ? "Hiding atlas" : "Showing atlas";
+        TraceLog(LOG_INFO, text);
+        should_draw_debug_ui = !should_draw_debug_ui;
+    }
+
+    if (should_draw_debug_ui) {
+        if (IsKeyPressed(KEY_F1)) post.enabled[POST_BLOOM]    = !post.enabled[POST_BLOOM];
+        if (IsKeyPressed(KEY_F2)) post.enabled[POST_VIGNETTE] = !post.enabled[POST_VIGNETTE];
+        if (IsKeyPressed(KEY_F3)) post.enabled[POST_PALETTE]  = !post.enabled[POST_PALETTE];
+        if (IsKeyPressed(KEY_F4)) set_pacer_mode(pacer.mode == PACER_VSYNC ? PACER_FREE_RUN : PACER_VSYNC);
+        if (IsKeyPressed(KEY_F5)) tracer.toggle = true;
+        if (IsKeyPressed(KEY_F7)) telemetry.per_second = !telemetry.per_second;
+#if !defined(PLATFORM_WEB)
+        if (IsKeyPressed(KEY_F6)) latency.mode = (latency.mode + 1)%LATENCY_MODE_COUNT;
+#endif
+    }
+
+    // PLAYER
+    I32 zone = trace_begin("update_player");
+
+    // Touch controls
+    Rect follow_icon_dst = (Rect) {20, screenHeight - 20 - 64, 64, 64};
+    Rect no_spell_icon_dst  = (Rect) {screenWidth - 30- 3*64, screenHeight - 20 - 64, 64, 64};
+    Rect mana_ray_icon_dst  = (Rect) {screenWidth - 25- 2*64, screenHeight - 20 - 64, 64, 64};
+    Rect death_ray_icon_dst = (Rect) {screenWidth - 20 - 64, screenHeight - 20 - 64 , 64, 64};
+
+    if (GetGestureDetected() == GESTURE_TAP) {
+        touch_active = true;
+        touch_start = GetTouchPosition(0);
+    }
+
+    if (CheckCollisionPointRec(touch_start, no_spell_icon_dst)) {
+        player.active_spell = NO_SPELL;
+        touch_start = (Vec2) {0};
+    }
+    if (CheckCollisionPointRec(touch_start, mana_ray_icon_dst)) {
+        player.active_spell = MANA_RAY;
+        touch_start = (Vec2) {0};
+    }
+    if (CheckCollisionPointRec(touch_start, death_ray_icon_dst)) {
+        player.active_spell = DEATH_RAY;
+        touch_start = (Vec2) {0};
+    }
+
+    if (latency.mode != LATENCY_LATE_LATCH) update_player_movement(dt);
+
+    player.health = Clamp(player.health, 0.0f, player.max_health);
+    player.invincibility_timer -= dt;
+    if (player.invincibility_timer <= 0) player.is_invincible = false;
+
+    apprentice.health = Clamp(apprentice.health, 0.0f, apprentice.max_health);
+    apprentice.invincibility_timer -= dt;
+    if (apprentice.invincibility_timer <= 0) apprentice.is_invincible = false;
+
+    if ((player.health <= 0 || apprentice.health <= 0) && !stress.enabled) {
+        game_over = true;
+    }
+    
+    apprentice.ray_anchor = Vector2Add(SPRITE_CENTER(apprentice.pos), (Vec2){0, 24});
+    F32 spellray_distance = Vector2Distance(player.ray_anchor, apprentice.ray_anchor);
+
+    if (key_pressed(KEY_Q)) {
+        player.active_spell = NO_SPELL; 
+    }
+
+    if (key_pressed(KEY_E)) {
+        player.active_spell = MANA_RAY;
+    }
+    if (key_pressed(KEY_R)) {
+        player.active_spell = DEATH_RAY;
+    }
+
+    if (player.active_spell != NO_SPELL) {
+        // Initial cast
+        if (!player.is_casting && 
+            player.mana >= SPELLS[player.active_spell].initial_cost*balance.spell_cost_scale &&
+            spellray_distance <= SPELLS[player.active_spell].activation_distance) {
+            player.is_casting = true;
+            player.mana -= SPELLS[player.active_spell].initial_cost*balance.spell_cost_scale;
+        }
+
+        // Continue cast
+        if (player.is_casting) {
+            if (spellray_distance >= SPELLS[player.active_spell].activation_distance) {
+                player.is_casting = false;
+            }
+
+            F32 mana_cost = SPELLS[player.active_spell].cost_per_second*balance.spell_cost_scale * dt;
+
+            if (player.mana >= mana_cost) {
+                player.mana -= mana_cost;
+            } else {
+                player.is_casting = false;
+                player.active_spell = NO_SPELL;
+            }
+        }
+    }
+
+    if (!player.is_casting) {
+        player.mana += player.mana_regen * dt;
+        player.mana = Clamp(player.mana, 0.0f, player.max_mana);
+
+        if (player.active_spell != NO_SPELL && 
+            player.mana >= SPELLS[player.active_spell].initial_cost*balance.spell_cost_scale &&
+            spellray_distance <= SPELLS[player.active_spell].activation_distance) {
+            player.is_casting = true;
+            player.mana -= SPELLS[player.active_spell].initial_cost*balance.spell_cost_scale;
+        }
+    }
+
+    trace_end(zone);
+
+    // Apprentice
+    zone = trace_begin("update_apprentice");
+
+    if (player.is_casting && player.active_spell == MANA_RAY) {
+        apprentice.mana += MANA_RAY_MANA_PER_SECOND * dt;
     }
     if (player.is_casting && player.active_spell == DEATH_RAY) {
-        apprentice.mana -= SPELLS[DEATH_RAY].cost_per_second * dt;
+        apprentice.mana -= SPELLS[DEATH_RAY].cost_per_second*balance.spell_cost_scale * dt;
     }
     if (apprentice.mana <= 0.0f) {
         player.is_casting = false;
@@ -471,7 +1933,7 @@ void update_gameplay(void) {
     apprentice.mana += apprentice.mana_regen * dt;
     apprentice.mana = Clamp(apprentice.mana, 0.0f, apprentice.max_mana);
 
-    if (IsKeyPressed(KEY_F)) {
+    if (key_pressed(KEY_F)) {
         apprentice.following_player = !apprentice.following_player;
     }
     if (CheckCollisionPointRec(touch_start, follow_icon_dst)) {
@@ -481,50 +1943,42 @@ void update_gameplay(void) {
 
 
     Vec2 appr_to_player_diff = Vector2Subtract(player.pos, apprentice.pos);
+    bool apprentice_moving = false;
     if (apprentice.following_player) {
         Vec2 appr_to_player_vel  = Vector2Normalize(appr_to_player_diff);
         F32  appr_to_player_dist = Vector2Distance(SPRITE_CENTER(player.pos), SPRITE_CENTER(apprentice.pos));
 
         if (appr_to_player_dist > TILE_SIZE*1.5f) {
             apprentice.pos = Vector2Add(apprentice.pos, Vector2Scale(appr_to_player_vel, apprentice.speed*dt));
+            apprentice_moving = true;
         }
     }
 
+    if (player.is_casting) {
+        play_clip(&apprentice.anim, CLIP_APPRENTICE_CAST);
+    } else if (apprentice_moving) {
+        play_clip(&apprentice.anim, CLIP_APPRENTICE_WALK);
+    } else {
+        play_clip(&apprentice.anim, CLIP_APPRENTICE_IDLE);
+    }
+
     if (appr_to_player_diff.x < 0) {
         apprentice.flip_texture = FLIP_X;
     } else {
         apprentice.flip_texture = NO_FLIP;
     }
 
+    trace_end(zone);
+
     // ENEMIES
     // TODO: shoot projectile in the direction of enemy.
+    zone = trace_begin("update_enemies");
+
+    update_enemy_separation();
 
     for (int i = 0; i < arrlen(enemies); i++) {
         Enemy* enemy = &enemies[i];
-        Vec2 separation = {0, 0};
-        int  neighbours = 0;
-
-        // calculate separation force
-        for (int j = 0; j < arrlen(enemies); j++) {
-            if (i==j) continue;
-
-            F32 distance = Vector2Distance(enemies[i].pos, enemies[j].pos);
-
-            if (distance < TILE_SIZE) {
-                Vec2 diff = Vector2Normalize(Vector2Subtract(enemies[i].pos, enemies[j].pos));
-                separation = Vector2Add(separation, Vector2Scale(diff, TILE_SIZE/1.5/distance));
-                neighbours++;
-            }
-        }
-
-        // average and limit separation force
-        if (neighbours > 0) {
-            separation = Vector2Scale(separation, 1.0f/neighbours);
-            F32 min_force = enemies[i].speed * 0.0005f;
-            F32 max_force = enemies[i].speed * 0.5f;
-
-            separation = Vector2ClampValue(separation, min_force, max_force);
-        }
+        Vec2 separation = enemy_grid.separation[i];
 
         Vec2 enemy_to_player_dist_vec = Vector2Subtract(player.pos, enemy->pos);
         Vec2 enemy_to_player_vel      = Vector2Add(Vector2Normalize(enemy_to_player_dist_vec), separation);
@@ -545,57 +1999,253 @@ void update_gameplay(void) {
         Rect enemy_rect      = (Rect){enemy->pos.x, enemy->pos.y, TILE_SIZE, TILE_SIZE};
 
         if (!player.is_invincible && CheckCollisionRecs(player_rect, enemy_rect)) {
-            player.health -= ENEMY_DAMAGE * (wave_id/2.0f);
+            player.health -= balance.enemy_damage * (wave_id/2.0f);
             player.is_invincible = true;
             player.invincibility_timer = 0.2f;
         }
 
         if (!apprentice.is_invincible && CheckCollisionRecs(apprentice_rect, enemy_rect)) {
-            apprentice.health -= ENEMY_DAMAGE;
+            apprentice.health -= balance.enemy_damage;
             apprentice.is_invincible = true;
             apprentice.invincibility_timer = 0.3f;
         }
 
         enemy->health = Clamp(enemy->health, 0.0f, enemy->max_health);
-        if (!enemy->alive) arrdel(enemies, i); 
+        if (!enemy->alive) {
+            arrdel(enemies, i);
+            arrdel(enemy_grid.separation, i);
+        }
 
         if (enemy->health == 0.0f) {
             enemy->alive = false;
-            PlaySound(death_sound);
+            play_sound(death_sound);
+            flight.current.counters.deaths++;
+
+            // The corpse decal is stamped when the death clip ends, see update_animations()
+            Dying_Enemy dying = {
+                .pos = enemy->pos,
+                .sprite = SPRITE_ENEMY_0 + enemy->id%4,
+                .palette = enemy_palette(enemy),
+                .flip_texture = enemy->flip_texture,
+                .anim = start_clip(CLIP_ENEMY_0_DEATH + enemy->id%4),
+            };
+            arrput(dying_enemies, dying);
+
+            static const U8 death_colors[] = {4, 4, 5, 3};
+            emit_particles(SPRITE_CENTER(enemy->pos), DEATH_BURST_PARTICLES, TILE_SIZE*6.0f, 0.6f,
+                death_colors, ARRAY_LEN(death_colors));
         }
 
         if (player.active_spell == DEATH_RAY && player.is_casting) {
             if (CheckCollisionPointLine(SPRITE_CENTER(enemy->pos), player.ray_anchor, apprentice.ray_anchor, 16*3)) {
-                enemy->health -= DEATH_RAY_DAMAGE;
+                enemy->health -= balance.death_ray_damage;
+
+                static const U8 hit_colors[] = {3, 4};
+                emit_particles(SPRITE_CENTER(enemy->pos), RAY_HIT_PARTICLES, TILE_SIZE*4.0f, 0.25f,
+                    hit_colors, ARRAY_LEN(hit_colors));
             }
         }
 
-        // Burn mana if enemies touch mana ray
-        if (player.active_spell == MANA_RAY && player.is_casting) {
-            if (CheckCollisionPointLine(SPRITE_CENTER(enemy->pos), player.ray_anchor, apprentice.ray_anchor, 16*3)) {
-                player.mana -= ENEMY_MANA_BURN;
+        // Burn mana if enemies touch mana ray
+        if (player.active_spell == MANA_RAY && player.is_casting) {
+            if (CheckCollisionPointLine(SPRITE_CENTER(enemy->pos), player.ray_anchor, apprentice.ray_anchor, 16*3)) {
+                player.mana -= ENEMY_MANA_BURN;
+            }
+        }
+
+    }
+    trace_end(zone);
+
+    zone = trace_begin("update_animations");
+    update_animations(dt);
+    trace_end(zone);
+
+    zone = trace_begin("update_particles");
+    update_particles(dt);
+    trace_end(zone);
+
+    if (player.active_spell == DEATH_RAY && player.is_casting) {
+        decals.scorch_timer -= dt;
+        if (decals.scorch_timer <= 0.0f) {
+            stamp_decal((Decal){ .kind = DECAL_SCORCH, .a = player.ray_anchor, .b = apprentice.ray_anchor });
+            decals.scorch_timer = DECAL_SCORCH_INTERVAL;
+        }
+    }
+
+    if (arrlen(enemies) == 0 && !waiting_for_next_wave) {
+        waiting_for_next_wave = true;
+        wave_id++;
+    }
+
+    if (waiting_for_next_wave) {
+        wave_timer += dt;
+        if (wave_timer >= 5.0f) {
+            spawn_next_wave(wave_id);
+            waiting_for_next_wave = false;
+            wave_timer = 0.0f;
+        }
+    }
+
+    trace_end(update_zone);
+}
+
+static I32 enemy_grid_axis(F32 coord) {
+    if (coord <= 0.0f) return 0;
+    if (coord >= ENEMY_GRID_SIZE*TILE_SIZE) return ENEMY_GRID_SIZE - 1;
+    return (I32)(coord/TILE_SIZE);
+}
+
+// Separation force of every enemy from the others within TILE_SIZE, averaged and limited by its speed.
+// All of it is computed from this frame's positions before any enemy moves. From ENEMY_GRID_MIN_ENEMIES
+// on, only the 3x3 cells around each enemy are searched, below that every enemy is. Clamping off-map
+// enemies to the edge cells never moves two of them more than a cell apart, so no pair within TILE_SIZE
+// is missed. Two enemies at the same position separate by a NaN force and stay NaN, no distance to them
+// is within TILE_SIZE, so they are left out of the cells
+void update_enemy_separation(void) {
+    F64 start = GetTime();
+    I32 count = (I32)arrlen(enemies);
+    bool use_grid = (count >= ENEMY_GRID_MIN_ENEMIES);
+    arrsetlen(enemy_grid.order, count);
+    arrsetlen(enemy_grid.cell, count);
+    arrsetlen(enemy_grid.separation, count);
+
+    if (use_grid) {
+        arrsetlen(enemy_grid.start, ENEMY_GRID_CELLS + 2);
+        memset(enemy_grid.start, 0, (ENEMY_GRID_CELLS + 2)*sizeof(U32));
+
+        for (I32 i = 0; i < count; i++) {
+            Vec2 pos = enemies[i].pos;
+            U32 cell = (U32)(enemy_grid_axis(pos.y)*ENEMY_GRID_SIZE + enemy_grid_axis(pos.x));
+            if (isnan(pos.x) || isnan(pos.y)) cell = ENEMY_GRID_CELLS;
+            enemy_grid.cell[i] = cell;
+            enemy_grid.start[cell]++;
+        }
+        // Offsets past the end of each cell, filling a cell backwards leaves its offset at its first index
+        for (I32 c = 1; c <= ENEMY_GRID_CELLS + 1; c++) {
+            enemy_grid.start[c] += enemy_grid.start[c - 1];
+        }
+        for (I32 i = count - 1; i >= 0; i--) {
+            enemy_grid.order[--enemy_grid.start[enemy_grid.cell[i]]] = (U32)i;
+        }
+    } else {
+        for (I32 i = 0; i < count; i++) enemy_grid.order[i] = (U32)i;
+    }
+
+    for (I32 i = 0; i < count; i++) {
+        Vec2 separation = {0, 0};
+        int  neighbours = 0;
+
+        // Ranges of order to compare against
+        U32 ranges[9][2];
+        I32 range_count = 0;
+        if (!use_grid) {
+            ranges[range_count][0] = 0;
+            ranges[range_count][1] = (U32)count;
+            range_count++;
+        } else if (enemy_grid.cell[i] < ENEMY_GRID_CELLS) {
+            I32 column = (I32)(enemy_grid.cell[i]%ENEMY_GRID_SIZE);
+            I32 row = (I32)(enemy_grid.cell[i]/ENEMY_GRID_SIZE);
+            for (I32 y = row - 1; y <= row + 1; y++) {
+                for (I32 x = column - 1; x <= column + 1; x++) {
+                    if ((x < 0) || (y < 0) || (x >= ENEMY_GRID_SIZE) || (y >= ENEMY_GRID_SIZE)) continue;
+                    ranges[range_count][0] = enemy_grid.start[y*ENEMY_GRID_SIZE + x];
+                    ranges[range_count][1] = enemy_grid.start[y*ENEMY_GRID_SIZE + x + 1];
+                    range_count++;
+                }
+            }
+        }
+
+        Vec2 pos = enemies[i].pos;
+        for (I32 r = 0; r < range_count; r++) {
+            for (U32 k = ranges[r][0]; k < ranges[r][1]; k++) {
+                I32 j = (I32)enemy_grid.order[k];
+                if (i == j) continue;
+
+                // Squared first, the square root is only taken for the few within reach
+                Vec2 offset = Vector2Subtract(pos, enemies[j].pos);
+                F32 distance_sqr = Vector2LengthSqr(offset);
+                if (distance_sqr >= TILE_SIZE*TILE_SIZE) continue;
+
+                F32 distance = sqrtf(distance_sqr);
+                if (distance < TILE_SIZE) {
+                    Vec2 diff = Vector2Normalize(offset);
+                    separation = Vector2Add(separation, Vector2Scale(diff, TILE_SIZE/1.5/distance));
+                    neighbours++;
+                }
+            }
+        }
+
+        // average and limit separation force
+        if (neighbours > 0) {
+            separation = Vector2Scale(separation, 1.0f/neighbours);
+            F32 min_force = enemies[i].speed * 0.0005f;
+            F32 max_force = enemies[i].speed * 0.5f;
+
+            separation = Vector2ClampValue(separation, min_force, max_force);
+        }
+        enemy_grid.separation[i] = separation;
+    }
+    enemy_grid.ms = (F32)((GetTime() - start)*1000.0);
+}
+
+// Keyboard and touch-drag movement. In the late latch latency mode it runs after the simulation,
+// right after input is polled, so the player is drawn with the freshest input
+void update_player_movement(F32 dt) {
+    Vec2 input = {0};
+
+    if (key_down(KEY_S) || key_down(KEY_DOWN)) {
+        input.y += 1;
+    }
+    if (key_down(KEY_W) || key_down(KEY_UP)) {
+        input.y -= 1;
+    }
+    if (key_down(KEY_A) || key_down(KEY_LEFT)) {
+        input.x -= 1;
+        player.flip_texture = FLIP_X;
+    }
+    if (key_down(KEY_D) || key_down(KEY_RIGHT)) {
+        input.x += 1;
+        player.flip_texture = NO_FLIP;
+    }
+
+    if (touch_active && GetTouchPointCount() > 0) {
+        Vec2 current_touch = GetTouchPosition(0);
+        Vec2 direction = Vector2Subtract(current_touch, touch_start);
+        
+        float min_distance = 10.0f;
+        if (Vector2Length(direction) > min_distance) {
+            input = Vector2Normalize(direction);
+            
+            if (input.x < 0) {
+                player.flip_texture = FLIP_X;
+            } else if (input.x > 0) {
+                player.flip_texture = NO_FLIP;
             }
         }
-
     }
 
-    if (arrlen(enemies) == 0 && !waiting_for_next_wave) {
-        waiting_for_next_wave = true;
-        wave_id++;
+    if (GetTouchPointCount() == 0) {
+        touch_active = false;
     }
 
-    if (waiting_for_next_wave) {
-        wave_timer += dt;
-        if (wave_timer >= 5.0f) {
-            spawn_next_wave(wave_id);
-            waiting_for_next_wave = false;
-            wave_timer = 0.0f;
-        }
+    input = Vector2Normalize(input);
+
+    player.pos = Vector2Add(player.pos, Vector2Scale(input, player.speed*dt));
+    if (player.is_casting) {
+        play_clip(&player.anim, CLIP_PLAYER_CAST);
+    } else if (input.x != 0.0f || input.y != 0.0f) {
+        play_clip(&player.anim, CLIP_PLAYER_WALK);
+    } else {
+        play_clip(&player.anim, CLIP_PLAYER_IDLE);
     }
+    player.pos = Vector2Clamp(player.pos, (Vec2){0, 0}, (Vec2){map_width, map_height});
 
+    camera.target = player.pos;
+    player.ray_anchor = Vector2Add(SPRITE_CENTER(player.pos), (Vec2){0, 24});
 }
 
 void spawn_next_wave(int wave_id) {
+    I32 zone = trace_begin("spawn_next_wave");
     int number_of_enemies = 2*wave_id;
     int random_val = GetRandomValue(map_width/10, map_width/4);
     int random_sign = GetRandomValue(0,1);
@@ -610,131 +2260,88 @@ void spawn_next_wave(int wave_id) {
             .pos = (Vec2){
                 (F32)map_width/2  + (F32)random_val + radius * cosf(angle),
                 (F32)map_height/2 + (F32)random_val + radius * sinf(angle)},
-                .speed = TILE_SIZE*1.5f,
+                .speed = balance.enemy_speed,
 
                 .health = 50.0f + wave_id * 10.0f,
                 .max_health = 50.0f + wave_id * 10.0f,
+                .anim = start_clip(CLIP_ENEMY_0_WALK + i%4),
             };
         arrput(enemies, enemy);
     }
-    PlaySound(new_wave_sound);
+    decals.fade_steps++;
+    play_sound(new_wave_sound);
+    flight.current.counters.spawns += number_of_enemies;
+    trace_end(zone);
 }
 
 void draw_gameplay(void) {
-    BeginMode2D(camera);
+    I32 zone = trace_begin("draw_gameplay");
+    BeginMode2D(get_world_camera());
 
         // TODO: Draw your game screen here
         // DrawRectangleLinesEx((Rect){0, 0, map_width, map_height}, TILE_SIZE, PAL5);
-        DrawTextureEx(background_texture, (Vec2){0, 0}, 0.0f, TILE_UPSCALE_FACTOR, WHITE);
-
-        Rect player_src = {0};
-        if (!player.is_invincible){
-            player_src = get_atlas(0,0);  
-        } else {
-            player_src = get_atlas(1,0);
+        BeginShaderMode(palette_lookup.shader);
+            DrawTextureEx(background_texture, (Vec2){0, 0}, 0.0f, TILE_UPSCALE_FACTOR, WHITE);
+        EndShaderMode();
+        DrawTexturePro(decals.texture.texture,
+            (Rect){0, 0, (F32)decals.texture.texture.width, -(F32)decals.texture.texture.height},
+            (Rect){0, 0, (F32)decals.texture.texture.width*TILE_UPSCALE_FACTOR, (F32)decals.texture.texture.height*TILE_UPSCALE_FACTOR},
+            (Vec2){0, 0}, 0.0f, WHITE);
+
+        arrsetlen(draw_list.sprites, 0);
+        arrsetlen(draw_list.keys, 0);
+
+        Palette_Row player_palette = PALETTE_ROW_BASE;
+        if (player.is_invincible) {
+            player_palette = PALETTE_ROW_HIT;
         }
-        draw_sprite(atlas, player_src, player.pos, player.flip_texture, WHITE);
+        push_sprite(clip_frame(player.anim), player_palette, player.pos, player.flip_texture, WHITE);
 
-        Rect apprentice_src = {0};
-        if (!apprentice.is_invincible) {
-            apprentice_src = get_atlas(0,1);
-        } else {
-            apprentice_src = get_atlas(1,1);
+        Palette_Row apprentice_palette = PALETTE_ROW_BASE;
+        if (apprentice.is_invincible) {
+            apprentice_palette = PALETTE_ROW_HIT;
         }
-        draw_sprite(atlas, apprentice_src, apprentice.pos, apprentice.flip_texture, WHITE);
+        push_sprite(clip_frame(apprentice.anim), apprentice_palette, apprentice.pos, apprentice.flip_texture, WHITE);
 
-        Rect enemy_src = {0};
         for (int i=0; i < arrlen(enemies); i++) {
-            enemy_src = get_atlas(enemies[i].id%4,2);
-            draw_sprite(atlas, enemy_src, enemies[i].pos, enemies[i].flip_texture, WHITE);
+            push_sprite(clip_frame(enemies[i].anim), enemy_palette(&enemies[i]),
+                enemies[i].pos, enemies[i].flip_texture, WHITE);
         }
-
-        if (player.is_casting) {
-            F32 ad;
-            switch (player.active_spell) {
-            case NO_SPELL: break;
-            case MANA_RAY:
-                ad = SPELLS[MANA_RAY].activation_distance;
-                DrawRing(apprentice.ray_anchor, ad-2, ad+2, 0, 360, 48, PAL0);
-
-                DrawCircleV(player.ray_anchor, 8, PAL0);
-                DrawCircleV(apprentice.ray_anchor, 8, PAL0);
-                DrawLineEx(player.ray_anchor, apprentice.ray_anchor, 16, PAL0);
-
-                DrawCircleV(player.ray_anchor, 5, PAL1);
-                DrawCircleV(apprentice.ray_anchor, 5, PAL1);
-                DrawLineEx(player.ray_anchor, apprentice.ray_anchor, 10, PAL1);
-                break;
-            case DEATH_RAY:
-                ad = SPELLS[MANA_RAY].activation_distance;
-                DrawRing(apprentice.ray_anchor, ad-2, ad+2, 0, 360, 48, PAL3);
-
-                DrawCircleV(player.ray_anchor, 8, PAL3);
-                DrawCircleV(apprentice.ray_anchor, 8, PAL3);
-                DrawLineEx(player.ray_anchor, apprentice.ray_anchor, 16, PAL3);
-
-                DrawCircleV(player.ray_anchor, 5, PAL4);
-                DrawCircleV(apprentice.ray_anchor, 5, PAL4);
-                DrawLineEx(player.ray_anchor, apprentice.ray_anchor, 10, PAL4);
-                break;            
-            }
+        for (int i=0; i < arrlen(dying_enemies); i++) {
+            push_sprite(clip_frame(dying_enemies[i].anim), dying_enemies[i].palette,
+                dying_enemies[i].pos, dying_enemies[i].flip_texture, WHITE);
         }
 
-        Rect player_health_rect = (Rect) {
-        player.pos.x, 
-        player.pos.y + TILE_SIZE + 8, 
-        (player.health/100.0f)*TILE_SIZE, 
-        8.0f
-        };
-        Rect player_mana_rect = (Rect) {
-        player.pos.x, 
-        player.pos.y + TILE_SIZE + 16, 
-        (player.mana/100.0f)*TILE_SIZE, 
-        8.0f
-        };
-        Rect appr_health_rect = (Rect) {
-        apprentice.pos.x, 
-        apprentice.pos.y + TILE_SIZE + 8, 
-        (apprentice.health/100.0f)*TILE_SIZE, 
-        8.0f
-        };
-        Rect appr_mana_rect = (Rect) {
-        apprentice.pos.x, 
-        apprentice.pos.y + TILE_SIZE + 16, 
-        (apprentice.mana/100.0f)*TILE_SIZE, 
-        8.0f
-        };
-        DrawRectangleRec(player_health_rect, PAL4);
-        DrawRectangleLinesEx(player_health_rect, 2, PAL5);
+        sort_draw_list();
+        BeginShaderMode(palette_lookup.shader);
+            draw_sprite_list();
+            draw_particles();
+        EndShaderMode();
 
-        DrawRectangleRec(player_mana_rect, PAL0);
-        DrawRectangleLinesEx(player_mana_rect, 2, PAL5);
+        if (player.is_casting) {
+            draw_spell_ray(player.active_spell, player.ray_anchor, apprentice.ray_anchor);
+        }
 
-        DrawRectangleRec(appr_health_rect, PAL4);
-        DrawRectangleLinesEx(appr_health_rect, 2, PAL5);
-        DrawRectangleRec(appr_mana_rect, PAL0);
-        DrawRectangleLinesEx(appr_mana_rect, 2, PAL5);
+        collect_actor_bars();
+        draw_bars();
 
         if (should_draw_debug_ui) {
             DrawRectangleLines(player.pos.x, player.pos.y, TILE_SIZE, TILE_SIZE, PAL0);
         }
 
     EndMode2D();
+    trace_end(zone);
 }
 
 void draw_ui(void) {
-    Rect follow_icon = get_atlas(3,9);
+    I32 zone = trace_begin("draw_ui");
+    Sprite_Id follow_icon = SPRITE_ICON_NOT_FOLLOWING;
     if (apprentice.following_player) {
-        follow_icon = get_atlas(4,9);
+        follow_icon = SPRITE_ICON_FOLLOWING;
     }
     F32 follow_icon_size = 64;
     Rect follow_icon_dst = (Rect) {20, screenHeight - 20 - follow_icon_size, follow_icon_size, follow_icon_size};
-    DrawTexturePro(atlas, follow_icon, follow_icon_dst, (Vec2){0, 0}, 0.0f, WHITE);
-
-    Rect no_spell_icon_rect  = get_atlas(0,9);
-    Rect mana_ray_icon_rect  = get_atlas(1,9);
-    Rect death_ray_icon_rect = get_atlas(2,9);
-    Rect spell_selected_rect = get_atlas(5,9);
+    draw_sprite_frame(follow_icon, PALETTE_ROW_BASE, follow_icon_dst, NO_FLIP, 0.0f, WHITE);
 
     Rect no_spell_icon_dst  = (Rect) {screenWidth - 30- 3*64, screenHeight - 20 - 64, 64, 64};
     Rect mana_ray_icon_dst  = (Rect) {screenWidth - 25- 2*64, screenHeight - 20 - 64, 64, 64};
@@ -753,10 +2360,10 @@ void draw_ui(void) {
         break;
     }
 
-    DrawTexturePro(atlas, no_spell_icon_rect, no_spell_icon_dst, (Vec2){0, 0}, 0.0f, WHITE);
-    DrawTexturePro(atlas, mana_ray_icon_rect, mana_ray_icon_dst, (Vec2){0, 0}, 0.0f, WHITE);
-    DrawTexturePro(atlas, death_ray_icon_rect, death_ray_icon_dst, (Vec2){0, 0}, 0.0f, WHITE);
-    DrawTexturePro(atlas, spell_selected_rect, spell_selected_dst, (Vec2){0, 0}, 0.0f, WHITE);
+    draw_sprite_frame(SPRITE_ICON_NO_SPELL, PALETTE_ROW_BASE, no_spell_icon_dst, NO_FLIP, 0.0f, WHITE);
+    draw_sprite_frame(SPRITE_ICON_MANA_RAY, PALETTE_ROW_BASE, mana_ray_icon_dst, NO_FLIP, 0.0f, WHITE);
+    draw_sprite_frame(SPRITE_ICON_DEATH_RAY, PALETTE_ROW_BASE, death_ray_icon_dst, NO_FLIP, 0.0f, WHITE);
+    draw_sprite_frame(SPRITE_ICON_SPELL_SELECTED, PALETTE_ROW_BASE, spell_selected_dst, NO_FLIP, 0.0f, WHITE);
 
     Rect player_health_rect = (Rect) {
         20, 
@@ -789,7 +2396,7 @@ void draw_ui(void) {
 
     // Rect wave_rect = (Rect) {}
     const char *wave_text = TextFormat("Wave %i", wave_id); 
-    int wave_text_width = MeasureText(wave_text, 20);
+    int wave_text_width = measure_text(wave_text, 20);
     Rect wave_rect = (Rect) {
         screenWidth - wave_text_width - 40,
         0,
@@ -798,15 +2405,15 @@ void draw_ui(void) {
     };
     DrawRectangleRec(wave_rect, PAL7);
     DrawRectangleLinesEx(wave_rect, 3, PAL5);
-    DrawText(wave_text, screenWidth - wave_text_width - 20, 20, 20, PAL5);
+    draw_text(wave_text, screenWidth - wave_text_width - 20, 20, 20, PAL5);
 
 
-    DrawText("MAGE", 20, 5, 20, PAL5);
+    draw_text("MAGE", 20, 5, 20, PAL5);
     DrawRectangleRec(player_health_rect, PAL4);
     DrawRectangleLinesEx(player_health_rect, 2, PAL5);
     DrawRectangleRec(player_mana_rect, PAL0);
     DrawRectangleLinesEx(player_mana_rect, 2, PAL5);
-    DrawText("APPRENTICE", 20, 62, 20, PAL5);
+    draw_text("APPRENTICE", 20, 62, 20, PAL5);
     DrawRectangleRec(apprentice_health_rect, PAL4);
     DrawRectangleLinesEx(apprentice_health_rect, 2, PAL5);
     DrawRectangleRec(apprentice_mana_rect, PAL0);
@@ -816,10 +2423,11 @@ void draw_ui(void) {
     if (gameplay_paused) {
         F32 fontsize = 40;
         const char* text = "GAME PAUSED";
-        DrawRectangle(screenWidth/2 - MeasureText(text, fontsize)/2 -TILE_SIZE/2, screenHeight/2 - fontsize/2, MeasureText(text,fontsize) + TILE_SIZE, fontsize, PAL7);
-        DrawText(text, screenWidth/2 - MeasureText(text, fontsize)/2, screenHeight/2 - fontsize/2, fontsize, PAL5);
+        DrawRectangle(screenWidth/2 - measure_text(text, fontsize)/2 -TILE_SIZE/2, screenHeight/2 - fontsize/2, measure_text(text,fontsize) + TILE_SIZE, fontsize, PAL7);
+        draw_text(text, screenWidth/2 - measure_text(text, fontsize)/2, screenHeight/2 - fontsize/2, fontsize, PAL5);
     }
 
+    trace_end(zone);
 }
 
 void draw_debug_ui(void) {
@@ -827,15 +2435,6 @@ void draw_debug_ui(void) {
 
     // if (should_draw_debug_ui) {
     //     DrawLineV(SPRITE_CENTER(player.pos), SPRITE_CENTER(enemies[i].pos), PAL4);
-
-    //     Rect enemy_health_rect = (Rect) {
-    //         enemies[i].pos.x, 
-    //         enemies[i].pos.y + TILE_SIZE + 10, 
-    //         (enemies[i].health/100.0f)*TILE_SIZE, 
-    //         10.0f
-    //     };
-    //     DrawRectangleRec(enemy_health_rect, PAL4);
-    //     DrawRectangleLinesEx(enemy_health_rect, 2, PAL5);
     // }
 
 
@@ -845,47 +2444,925 @@ void draw_debug_ui(void) {
         DrawRectangleV(pos, size, Color_Palette[i]);
         Color color = i == 5 ? PAL0 : PAL5;
 
-        DrawText(TextFormat("%d", i), (int)pos.x + 4, (int)pos.y + 4, 24, color);
+        draw_text(TextFormat("%d", i), (int)pos.x + 4, (int)pos.y + 4, 24, color);
+    }
+
+    draw_text(TextFormat("MANA: %.2f", player.mana), 16, screenHeight-40, 20, PAL4);
+    draw_text(TextFormat("dt: %f", frame_dt), 16, screenHeight-60, 20, PAL4);
+    draw_text(TextFormat("Spell: %i", player.active_spell), 16, screenHeight-80, 20, PAL4);
+    draw_text(TextFormat("Render scale: %d%% (%ix%i), scaled: %.2f ms, fixed: %.2f ms", (int)(dynres.scale*100.0f),
+        target.texture.width, target.texture.height, dynres.scaled_ms, dynres.fixed_ms), 16, screenHeight-100, 20, PAL4);
+
+    draw_text(TextFormat("Particles: %i / %i", particles.count, particles.limit), 16, screenHeight-120, 20, PAL4);
+    draw_text(TextFormat("[F1] Bloom: %s %.2f ms  [F2] Vignette: %s  [F3] Palette: %s  Composite (vignette, palette, bloom add): %.2f ms",
+        post.enabled[POST_BLOOM] ? "on" : "off", post.bloom_ms,
+        post.enabled[POST_VIGNETTE] ? "on" : "off",
+        post.enabled[POST_PALETTE] ? "on" : "off", post.composite_ms), 16, screenHeight-140, 10, PAL4);
+
+#if !defined(PLATFORM_WEB)
+    if (pacer.frames > 0) {
+        F64 mean = pacer.error_sum/pacer.frames;
+        F64 rms = sqrt(pacer.error_sq_sum/pacer.frames);
+        draw_text(TextFormat("[F4] Pacer: %s %.1f Hz, error mean %.3f rms %.3f max %.3f ms, late %u/%u, spin %.2f ms/frame",
+            pacer.mode == PACER_VSYNC ? "vsync" : "free run", 1.0/pacer.period,
+            mean*1000.0, rms*1000.0, pacer.max_error*1000.0, pacer.late_frames, pacer.frames,
+            pacer.spin_time*1000.0/pacer.frames), 16, screenHeight-152, 10, PAL4);
     }
+#endif
 
-    DrawText(TextFormat("MANA: %.2f", player.mana), 16, screenHeight-40, 20, PAL4);
-    DrawText(TextFormat("dt: %f", GetFrameTime()), 16, screenHeight-60, 20, PAL4);
-    DrawText(TextFormat("Spell: %i", player.active_spell), 16, screenHeight-80, 20, PAL4);
+    static const char *latency_modes[LATENCY_MODE_COUNT] = { "default", "low", "late latch" };
+    draw_text(TextFormat("[F6] Latency: %s, input to present last %.1f mean %.1f max %.1f ms (%u)",
+        latency_modes[latency.mode], latency.last*1000.0, latency.samples > 0 ? latency.sum*1000.0/latency.samples : 0.0,
+        latency.max*1000.0, latency.samples), 16, screenHeight-188, 10, PAL4);
+    draw_text(TextFormat("[F7] Telemetry: %u rows, per second %s", telemetry.rows,
+        telemetry.per_second ? "on" : "off"), 16, screenHeight-200, 10, PAL4);
+    draw_text(TextFormat("Flight recorder: hitch over %.1f ms, %i dumped%s", flight.threshold_ms, flight.dumps,
+        flight.dump_countdown > 0 ? ", dump pending" : ""), 16, screenHeight-176, 10, PAL4);
+    draw_text(tracer.enabled ? TextFormat("[F5] Trace: recording, %u zones written", tracer.written + tracer.count)
+        : "[F5] Trace: off", 16, screenHeight-164, 10, PAL4);
+
+    // GPU times are per bind group, on the pass opening it
+    int pass_x = screenWidth - 264;
+    F32 cpu_ms = 0.0f;
+    F32 gpu_ms = 0.0f;
+    for (I32 i = 0; i < PASS_COUNT; i++) {
+        cpu_ms += render_graph.stats[i].cpu_ms;
+        gpu_ms += render_graph.stats[i].gpu_ms;
+    }
+    draw_text(TextFormat("Render graph: %i passes, %i groups, cpu %.2f gpu %.2f ms", render_graph.count,
+        render_graph.groups, cpu_ms, gpu_ms), pass_x, 68, 10, PAL4);
+    draw_text("pass              cpu   gpu draws  verts binds", pass_x, 80, 10, PAL4);
+    for (I32 i = 0; i < PASS_COUNT; i++) {
+        Render_Pass_Stats stats = render_graph.stats[i];
+        const char *gpu = stats.gpu_timed ? TextFormat("%5.2f", stats.gpu_ms) : "    -";
+        const char *line = stats.culled ? TextFormat("%-16s culled", RENDER_PASS_NAMES[i])
+            : TextFormat("%-16s%5.2f %s %5u %6u %5u", RENDER_PASS_NAMES[i], stats.cpu_ms, gpu,
+                stats.draw_calls, stats.vertices, stats.texture_binds);
+        draw_text(line, pass_x, 94 + i*12, 10, PAL4);
+    }
+    draw_frame_stats(pass_x, 100 + PASS_COUNT*12);
+    draw_memory_stats(pass_x, 360);
 
-    DrawFPS(10,10);
+    draw_text(TextFormat("%2i FPS", (int)roundf(1.0f/smoothed_frame_dt)), 10, 10, 20, PAL1);
 }
 
-Rect get_atlas(int col, int row) {
-    return (Rect) {
-        (F32) 0 + col * TILE_SIZE_ORIGINAL,
-        (F32) 0 + row * TILE_SIZE_ORIGINAL,
-        TILE_SIZE_ORIGINAL,
-        TILE_SIZE_ORIGINAL,
+void init_particles(I32 capacity) {
+    // Pad to the SIMD width so the integration loop never needs a scalar tail on the arrays
+    capacity = (capacity + 3) & ~3;
+
+    // One block for all arrays, the system never allocates after this
+    size_t floats = (size_t)capacity*sizeof(F32);
+    Alloc_Tag previous_tag = set_alloc_tag(ALLOC_PARTICLES);
+    U8 *block = RL_CALLOC(1, 6*floats + (size_t)capacity);
+    set_alloc_tag(previous_tag);
+    particles = (Particle_System){
+        .pos_x    = (F32 *)(block + 0*floats),
+        .pos_y    = (F32 *)(block + 1*floats),
+        .vel_x    = (F32 *)(block + 2*floats),
+        .vel_y    = (F32 *)(block + 3*floats),
+        .life     = (F32 *)(block + 4*floats),
+        .lifetime = (F32 *)(block + 5*floats),
+        .color    = block + 6*floats,
+        .capacity = capacity,
+        .limit    = capacity,
+        .rng      = 0x9E3779B9u,
     };
+
+    // Find a texel of each palette index in the atlas
+    for (int c = 0; c < ARRAY_LEN(Color_Palette); c++) {
+        for (int t = 0; t < ATLAS_WIDTH*ATLAS_HEIGHT; t++) {
+            if (ATLAS_DATA[t] == c + 1) {
+                particles.palette_texels[c] = (Rect){(F32)(t % ATLAS_WIDTH), (F32)(t / ATLAS_WIDTH), 1, 1};
+                break;
+            }
+        }
+    }
 }
 
-void draw_sprite(Texture2D texture, Rectangle src, Vector2 position, Flip_Texture flip, Color tint)
-{
-    Rectangle dst = { 
-        position.x, 
-        position.y, 
-        fabsf(src.width)*TILE_UPSCALE_FACTOR,
-        fabsf(src.height)*TILE_UPSCALE_FACTOR
+void free_particles(void) {
+    RL_FREE(particles.pos_x);
+    particles = (Particle_System){0};
+}
+
+// Particles alive above a lowered limit keep flying, only new ones are dropped until they die out
+void set_particle_limit(I32 limit) {
+    particles.limit = (I32)Clamp((F32)limit, 0.0f, (F32)particles.capacity);
+}
+
+static U32 particle_random(void) {
+    // xorshift32, GetRandomValue() is too slow to call per particle
+    U32 x = particles.rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    particles.rng = x;
+    return x;
+}
+
+static F32 particle_random_01(void) {
+    return (F32)(particle_random() >> 8)*(1.0f/16777216.0f);
+}
+
+// Spawns up to `count` particles flying out of `pos`, fewer if the system is near its limit
+void emit_particles(Vec2 pos, I32 count, F32 speed, F32 lifetime, const U8 *colors, I32 color_count) {
+    I32 available = particles.limit - particles.count;
+    if (count > available) count = available;
+
+    for (I32 n = 0; n < count; n++) {
+        I32 i = particles.count++;
+        F32 angle = particle_random_01()*2.0f*PI;
+        F32 v = speed*(0.25f + 0.75f*particle_random_01());
+        F32 life = lifetime*(0.5f + 0.5f*particle_random_01());
+
+        particles.pos_x[i]    = pos.x;
+        particles.pos_y[i]    = pos.y;
+        particles.vel_x[i]    = cosf(angle)*v;
+        particles.vel_y[i]    = sinf(angle)*v;
+        particles.life[i]     = life;
+        particles.lifetime[i] = life;
+        particles.color[i]    = colors[particle_random() % color_count];
+    }
+}
+
+void update_particles(F32 dt) {
+    F32 drag = fmaxf(1.0f - PARTICLE_DRAG*dt, 0.0f);
+    I32 count = particles.count;
+
+    // Integrate in groups of 4, capacity is padded so reading past count stays inside the arrays
+    I32 i = 0;
+#if defined(PARTICLES_SSE2)
+    __m128 dt4   = _mm_set1_ps(dt);
+    __m128 drag4 = _mm_set1_ps(drag);
+    for (; i < count; i += 4) {
+        __m128 vx = _mm_loadu_ps(particles.vel_x + i);
+        __m128 vy = _mm_loadu_ps(particles.vel_y + i);
+        _mm_storeu_ps(particles.pos_x + i, _mm_add_ps(_mm_loadu_ps(particles.pos_x + i), _mm_mul_ps(vx, dt4)));
+        _mm_storeu_ps(particles.pos_y + i, _mm_add_ps(_mm_loadu_ps(particles.pos_y + i), _mm_mul_ps(vy, dt4)));
+        _mm_storeu_ps(particles.vel_x + i, _mm_mul_ps(vx, drag4));
+        _mm_storeu_ps(particles.vel_y + i, _mm_mul_ps(vy, drag4));
+        _mm_storeu_ps(particles.life + i, _mm_sub_ps(_mm_loadu_ps(particles.life + i), dt4));
+    }
+#else
+    for (; i < count; i++) {
+        particles.pos_x[i] += particles.vel_x[i]*dt;
+        particles.pos_y[i] += particles.vel_y[i]*dt;
+        particles.vel_x[i] *= drag;
+        particles.vel_y[i] *= drag;
+        particles.life[i]  -= dt;
+    }
+#endif
+
+    // Remove dead particles by moving the last one into their slot
+    for (i = 0; i < count;) {
+        if (particles.life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        count--;
+        particles.pos_x[i]    = particles.pos_x[count];
+        particles.pos_y[i]    = particles.pos_y[count];
+        particles.vel_x[i]    = particles.vel_x[count];
+        particles.vel_y[i]    = particles.vel_y[count];
+        particles.life[i]     = particles.life[count];
+        particles.lifetime[i] = particles.lifetime[count];
+        particles.color[i]    = particles.color[count];
+    }
+    particles.count = count;
+}
+
+// Draws all particles as shrinking quads sampling a single palette texel of the atlas,
+// in chunks so each chunk fits the current render batch
+// NOTE: Expects the palette shader to be active
+void draw_particles(void) {
+    const I32 chunk_size = 1024;
+    F32 inv_width  = 1.0f/atlas.width;
+    F32 inv_height = 1.0f/atlas.height;
+
+    rlSetTexture(atlas.id);
+    for (I32 start = 0; start < particles.count; start += chunk_size) {
+        I32 end = start + chunk_size;
+        if (end > particles.count) end = particles.count;
+
+        rlCheckRenderBatchLimit(4*(end - start));
+        rlBegin(RL_QUADS);
+            rlColor4ub(255, 255, 255, 255);
+            for (I32 i = start; i < end; i++) {
+                Rect texel = particles.palette_texels[particles.color[i]];
+                F32 half = 0.5f*PARTICLE_SIZE*(particles.life[i]/particles.lifetime[i]) + 0.5f;
+                F32 x = particles.pos_x[i];
+                F32 y = particles.pos_y[i];
+
+                rlTexCoord2f((texel.x + 0.5f)*inv_width, (texel.y + 0.5f)*inv_height);
+                rlVertex2f(x - half, y - half);
+                rlVertex2f(x - half, y + half);
+                rlVertex2f(x + half, y + half);
+                rlVertex2f(x + half, y - half);
+            }
+        rlEnd();
+    }
+    rlSetTexture(0);
+}
+
+void load_post_process(void) {
+    post.threshold_shader = LoadShaderFromMemory(NULL, BLOOM_THRESHOLD_FRAGMENT_SHADER);
+    post.blur_shader      = LoadShaderFromMemory(NULL, BLUR_FRAGMENT_SHADER);
+    post.composite_shader = LoadShaderFromMemory(NULL, POST_COMPOSITE_FRAGMENT_SHADER);
+
+    post.threshold_loc         = GetShaderLocation(post.threshold_shader, "threshold");
+    post.direction_loc         = GetShaderLocation(post.blur_shader, "direction");
+    post.bloom_loc             = GetShaderLocation(post.composite_shader, "bloom");
+    post.bloom_intensity_loc   = GetShaderLocation(post.composite_shader, "bloom_intensity");
+    post.vignette_strength_loc = GetShaderLocation(post.composite_shader, "vignette_strength");
+    post.palette_enabled_loc   = GetShaderLocation(post.composite_shader, "palette_enabled");
+    post.palette_loc           = GetShaderLocation(post.composite_shader, "palette");
+
+    F32 threshold = BLOOM_THRESHOLD;
+    SetShaderValue(post.threshold_shader, post.threshold_loc, &threshold, SHADER_UNIFORM_FLOAT);
+
+    Vector3 palette[ARRAY_LEN(Color_Palette)] = {0};
+    for (int i = 0; i < ARRAY_LEN(Color_Palette); i++) {
+        Vector4 c = ColorNormalize(Color_Palette[i]);
+        palette[i] = (Vector3){c.x, c.y, c.z};
+    }
+    SetShaderValueV(post.composite_shader, post.palette_loc, palette, SHADER_UNIFORM_VEC3, ARRAY_LEN(Color_Palette));
+
+    resize_bloom_pyramid();
+}
+
+void unload_post_process(void) {
+    for (int i = 0; i < BLOOM_LEVELS; i++) {
+        UnloadRenderTexture(post.bloom_down[i]);
+        UnloadRenderTexture(post.bloom_temp[i]);
+    }
+    UnloadShader(post.threshold_shader);
+    UnloadShader(post.blur_shader);
+    UnloadShader(post.composite_shader);
+}
+
+// Half, quarter and eighth of the world target, follows dynamic resolution changes
+void resize_bloom_pyramid(void) {
+    for (int i = 0; i < BLOOM_LEVELS; i++) {
+        if (post.bloom_down[i].id > 0) UnloadRenderTexture(post.bloom_down[i]);
+        if (post.bloom_temp[i].id > 0) UnloadRenderTexture(post.bloom_temp[i]);
+
+        int width  = target.texture.width >> (i + 1);
+        int height = target.texture.height >> (i + 1);
+        post.bloom_down[i] = LoadRenderTexture(width, height);
+        post.bloom_temp[i] = LoadRenderTexture(width, height);
+        SetTextureFilter(post.bloom_down[i].texture, TEXTURE_FILTER_BILINEAR);
+        SetTextureFilter(post.bloom_temp[i].texture, TEXTURE_FILTER_BILINEAR);
+    }
+}
+
+// Draws all of `src` over `dst`, stretched with the bilinear filter
+static void blit_render_texture(RenderTexture2D src, RenderTexture2D dst) {
+    DrawTexturePro(src.texture,
+        (Rect){0, 0, (F32)src.texture.width, -(F32)src.texture.height},
+        (Rect){0, 0, (F32)dst.texture.width, (F32)dst.texture.height},
+        (Vec2){0, 0}, 0.0f, WHITE);
+}
+
+// Bright pass into the half resolution level, downsample to the smaller levels, blur every level
+// separably and add them back up into the half resolution level, which the composite samples.
+// The blur runs at most at half resolution, so bloom costs a fraction of a full resolution blur.
+void render_bloom(void) {
+    post.bloom_ms = 0.0f;
+    if (!post.enabled[POST_BLOOM]) return;
+    F64 start = GetTime();
+
+    BeginTextureMode(post.bloom_down[0]);
+        ClearBackground(BLACK);
+        BeginShaderMode(post.threshold_shader);
+            blit_render_texture(target, post.bloom_down[0]);
+        EndShaderMode();
+    EndTextureMode();
+
+    for (int i = 1; i < BLOOM_LEVELS; i++) {
+        BeginTextureMode(post.bloom_down[i]);
+            ClearBackground(BLACK);
+            blit_render_texture(post.bloom_down[i - 1], post.bloom_down[i]);
+        EndTextureMode();
+    }
+
+    BeginShaderMode(post.blur_shader);
+    for (int i = 0; i < BLOOM_LEVELS; i++) {
+        Vec2 horizontal = {1.0f/post.bloom_down[i].texture.width, 0.0f};
+        Vec2 vertical   = {0.0f, 1.0f/post.bloom_down[i].texture.height};
+
+        SetShaderValue(post.blur_shader, post.direction_loc, &horizontal, SHADER_UNIFORM_VEC2);
+        BeginTextureMode(post.bloom_temp[i]);
+            blit_render_texture(post.bloom_down[i], post.bloom_temp[i]);
+        EndTextureMode();
+
+        SetShaderValue(post.blur_shader, post.direction_loc, &vertical, SHADER_UNIFORM_VEC2);
+        BeginTextureMode(post.bloom_down[i]);
+            blit_render_texture(post.bloom_temp[i], post.bloom_down[i]);
+        EndTextureMode();
+    }
+    EndShaderMode();
+
+    BeginBlendMode(BLEND_ADDITIVE);
+    for (int i = BLOOM_LEVELS - 1; i > 0; i--) {
+        BeginTextureMode(post.bloom_down[i - 1]);
+            blit_render_texture(post.bloom_down[i], post.bloom_down[i - 1]);
+        EndTextureMode();
+    }
+    EndBlendMode();
+
+    post.bloom_ms = (F32)((GetTime() - start)*1000.0);
+}
+
+// Wraps the draw of the world target to the screen. Vignette, palette quantization and adding the bloom
+// are uniforms of the one composite shader, so they share this draw and post.composite_ms times them
+// together, toggling one off and comparing is how to tell them apart
+void begin_post_composite(void) {
+    post.composite_ms = 0.0f;
+    post.composite_active = post.enabled[POST_BLOOM] || post.enabled[POST_VIGNETTE] || post.enabled[POST_PALETTE];
+    if (!post.composite_active) return;
+
+    F32 bloom_intensity   = post.enabled[POST_BLOOM] ? BLOOM_INTENSITY : 0.0f;
+    F32 vignette_strength = post.enabled[POST_VIGNETTE] ? VIGNETTE_STRENGTH : 0.0f;
+    int palette_enabled   = post.enabled[POST_PALETTE];
+
+    post.composite_start = GetTime();
+    SetShaderValue(post.composite_shader, post.bloom_intensity_loc, &bloom_intensity, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(post.composite_shader, post.vignette_strength_loc, &vignette_strength, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(post.composite_shader, post.palette_enabled_loc, &palette_enabled, SHADER_UNIFORM_INT);
+    BeginShaderMode(post.composite_shader);
+    SetShaderValueTexture(post.composite_shader, post.bloom_loc, post.bloom_down[0].texture);
+}
+
+void end_post_composite(void) {
+    if (!post.composite_active) return;
+    EndShaderMode();
+    post.composite_ms = (F32)((GetTime() - post.composite_start)*1000.0);
+}
+
+// Keeps the light buffer at a fixed fraction of the world target
+void resize_light_buffer(void) {
+    if (lights.texture.id > 0) UnloadRenderTexture(lights.texture);
+    lights.texture = LoadRenderTexture(target.texture.width/LIGHT_BUFFER_DIVISOR, target.texture.height/LIGHT_BUFFER_DIVISOR);
+    SetTextureFilter(lights.texture.texture, TEXTURE_FILTER_BILINEAR);
+}
+
+void draw_light(Vec2 center, F32 radius, Color color) {
+    DrawTexturePro(lights.falloff, (Rect){0, 0, (F32)lights.falloff.width, (F32)lights.falloff.height},
+        (Rect){center.x - radius, center.y - radius, 2*radius, 2*radius}, (Vec2){0, 0}, 0.0f, color);
+}
+
+// The radial falloff stretched along the beam, so a ray costs one quad too
+void draw_light_beam(Vec2 from, Vec2 to, F32 width, Color color) {
+    Vec2 center = Vector2Lerp(from, to, 0.5f);
+    F32 length = Vector2Distance(from, to) + 2*width;
+    F32 angle = atan2f(to.y - from.y, to.x - from.x)*RAD2DEG;
+    DrawTexturePro(lights.falloff, (Rect){0, 0, (F32)lights.falloff.width, (F32)lights.falloff.height},
+        (Rect){center.x, center.y, length, 2*width}, (Vec2){length/2, width}, angle, color);
+}
+
+// Accumulates ambient light plus additive light quads into the low resolution light buffer.
+// NOTE: Must run outside of any other BeginTextureMode()
+void render_lights(void) {
+    Camera2D light_camera = get_world_camera();
+    light_camera.offset = Vector2Scale(light_camera.offset, 1.0f/LIGHT_BUFFER_DIVISOR);
+    light_camera.zoom  /= LIGHT_BUFFER_DIVISOR;
+
+    BeginTextureMode(lights.texture);
+        ClearBackground(LIGHT_AMBIENT);
+        BeginMode2D(light_camera);
+        BeginBlendMode(BLEND_ADDITIVE);
+            draw_light(SPRITE_CENTER(player.pos), LIGHT_CASTER_RADIUS, LIGHT_CASTER_COLOR);
+            draw_light(SPRITE_CENTER(apprentice.pos), LIGHT_CASTER_RADIUS, LIGHT_CASTER_COLOR);
+
+            if (player.is_casting && player.active_spell != NO_SPELL) {
+                Color glow = (player.active_spell == MANA_RAY) ? PAL1 : PAL4;
+                draw_light_beam(player.ray_anchor, apprentice.ray_anchor, LIGHT_RAY_WIDTH, glow);
+                draw_light(player.ray_anchor, LIGHT_RAY_WIDTH, glow);
+                draw_light(apprentice.ray_anchor, LIGHT_RAY_WIDTH, glow);
+            }
+        EndBlendMode();
+        EndMode2D();
+    EndTextureMode();
+}
+
+void stamp_decal(Decal decal) {
+    arrput(decals.pending, decal);
+}
+
+// Applies pending clears, wave fades and stamps to the decal layer.
+// NOTE: Must run outside of any other BeginTextureMode(), decals are drawn at background resolution
+void bake_decals(void) {
+    if (!decals.clear && decals.fade_steps == 0 && arrlen(decals.pending) == 0) return;
+
+    BeginTextureMode(decals.texture);
+    BeginShaderMode(palette_lookup.shader);
+        if (decals.clear) ClearBackground(BLANK);
+
+        if (!decals.clear && decals.fade_steps > 0) {
+            // dst = dst*src_alpha, fades color and alpha of everything already stamped
+            F32 keep = powf(DECAL_WAVE_FADE, (F32)decals.fade_steps);
+            rlSetBlendFactors(RL_ZERO, RL_SRC_ALPHA, RL_FUNC_ADD);
+            BeginBlendMode(BLEND_CUSTOM);
+                DrawRectangle(0, 0, decals.texture.texture.width, decals.texture.texture.height,
+                    (Color){0, 0, 0, (unsigned char)(keep*255.0f)});
+            EndBlendMode();
+        }
+        decals.clear = false;
+        decals.fade_steps = 0;
+
+        for (int i = 0; i < arrlen(decals.pending); i++) {
+            Decal decal = decals.pending[i];
+            Vec2 a = Vector2Scale(decal.a, 1.0f/TILE_UPSCALE_FACTOR);
+            Vec2 b = Vector2Scale(decal.b, 1.0f/TILE_UPSCALE_FACTOR);
+
+            switch (decal.kind) {
+            case DECAL_CORPSE:
+                {
+                    Rect frame = {a.x, a.y, TILE_SIZE_ORIGINAL, TILE_SIZE_ORIGINAL};
+
+                    // Blood puddle with the enemy lying on its side on top
+                    draw_sprite_frame(SPRITE_BLOOD, PALETTE_ROW_BASE, frame, NO_FLIP, 0.0f, WHITE);
+                    draw_sprite_frame(decal.sprite, PALETTE_ROW_CORPSE, frame, decal.flip, 90.0f, WHITE);
+                } break;
+            case DECAL_SCORCH:
+                DrawLineEx(a, b, DECAL_SCORCH_THICKNESS, Fade(PAL5, 0.08f));
+                break;
+            }
+        }
+    EndShaderMode();
+    EndTextureMode();
+
+    arrsetlen(decals.pending, 0);
+}
+
+void push_sprite(Clip_Frame frame, Palette_Row palette, Vec2 pos, Flip_Texture flip, Color tint) {
+    Sprite_Instance sprite = {
+        .frame = frame,
+        .palette = palette,
+        .pos  = pos,
+        .flip = flip,
+        .tint = tint,
+    };
+    arrput(draw_list.sprites, sprite);
+
+    F32 y = Clamp((pos.y + DRAW_SORT_Y_OFFSET)*DRAW_SORT_Y_STEPS_PER_UNIT, 0.0f, 65535.0f);
+    arrput(draw_list.keys, (U16)y);
+}
+
+// Orders the draw list back to front by y.
+// Starts from last frame's order when the sprite count is unchanged: sprites only move a little
+// per frame, so that order is almost sorted and a bounded insertion sort finishes it. Otherwise,
+// or when the insertion sort runs out of budget, a two pass LSD radix sort (8 bit digits) is used,
+// skipping passes where every key shares the same digit.
+void sort_draw_list(void) {
+    I32 count = (I32)arrlen(draw_list.sprites);
+    bool coherent = (arrlen(draw_list.prev_order) == count);
+
+    arrsetlen(draw_list.records, count);
+    arrsetlen(draw_list.scratch, count);
+    U64 *records = draw_list.records;
+    U64 *scratch = draw_list.scratch;
+
+    I32 descents = 0;
+    for (I32 i = 0; i < count; i++) {
+        U32 index = coherent ? draw_list.prev_order[i] : (U32)i;
+        records[i] = ((U64)draw_list.keys[index] << 32) | index;
+        if ((i > 0) && ((records[i] >> 32) < (records[i - 1] >> 32))) descents++;
+    }
+
+    bool sorted = (descents == 0);
+
+    if (!sorted && coherent) {
+        I32 moves = 0;
+        I32 i = 1;
+        for (; (i < count) && (moves < DRAW_SORT_INSERTION_BUDGET); i++) {
+            U64 record = records[i];
+            I32 j = i - 1;
+            while ((j >= 0) && ((records[j] >> 32) > (record >> 32))) {
+                records[j + 1] = records[j];
+                j--;
+                moves++;
+            }
+            records[j + 1] = record;
+        }
+        sorted = (i == count);
+    }
+
+    if (!sorted) {
+        U32 histogram[2][256] = {0};
+        for (I32 i = 0; i < count; i++) {
+            U32 key = (U32)(records[i] >> 32);
+            histogram[0][key & 0xFF]++;
+            histogram[1][key >> 8]++;
+        }
+
+        for (I32 pass = 0; pass < 2; pass++) {
+            U32 shift = 32 + pass*8;
+            U32 *buckets = histogram[pass];
+            if (buckets[(records[0] >> shift) & 0xFF] == (U32)count) continue;
+
+            U32 offset = 0;
+            for (I32 b = 0; b < 256; b++) {
+                U32 bucket_count = buckets[b];
+                buckets[b] = offset;
+                offset += bucket_count;
+            }
+            for (I32 i = 0; i < count; i++) {
+                scratch[buckets[(records[i] >> shift) & 0xFF]++] = records[i];
+            }
+
+            U64 *tmp = records;
+            records = scratch;
+            scratch = tmp;
+        }
+
+        // Keep the sorted records in draw_list.records whichever buffer they ended up in
+        draw_list.records = records;
+        draw_list.scratch = scratch;
+    }
+
+    arrsetlen(draw_list.prev_order, count);
+    for (I32 i = 0; i < count; i++) {
+        draw_list.prev_order[i] = (U32)draw_list.records[i];
+    }
+}
+
+Anim_State start_clip(Clip_Id clip) {
+    return (Anim_State){ .clip = (U8)clip, .ticks = CLIP_FRAMES[CLIPS[clip].first].ticks };
+}
+
+// Switches clips only when it changes, so a looping clip keeps its phase
+void play_clip(Anim_State *anim, Clip_Id clip) {
+    if (anim->clip != clip) *anim = start_clip(clip);
+}
+
+void tick_animation(Anim_State *anim, U32 ticks) {
+    while (ticks > 0 && !anim->finished) {
+        if (anim->ticks > ticks) {
+            anim->ticks -= ticks;
+            return;
+        }
+        ticks -= anim->ticks;
+
+        Clip clip = CLIPS[anim->clip];
+        if (anim->frame + 1 < clip.count) {
+            anim->frame++;
+        } else if (clip.loop) {
+            anim->frame = 0;
+        } else {
+            anim->finished = true;
+            return;
+        }
+        anim->ticks = CLIP_FRAMES[clip.first + anim->frame].ticks;
+    }
+}
+
+// Advances every animation cursor by the whole ticks elapsed since the last call,
+// then stamps the corpses of enemies whose death clip has ended
+void update_animations(F32 dt) {
+    anim_time += dt;
+    U32 ticks = (U32)(anim_time*ANIM_TICK_RATE);
+    if (ticks == 0) return;
+    anim_time -= (F32)ticks/ANIM_TICK_RATE;
+
+    tick_animation(&player.anim, ticks);
+    tick_animation(&apprentice.anim, ticks);
+    for (int i = 0; i < arrlen(enemies); i++) tick_animation(&enemies[i].anim, ticks);
+    for (int i = 0; i < arrlen(dying_enemies); i++) tick_animation(&dying_enemies[i].anim, ticks);
+
+    for (int i = (int)arrlen(dying_enemies) - 1; i >= 0; i--) {
+        Dying_Enemy *dying = &dying_enemies[i];
+        if (!dying->anim.finished) continue;
+
+        stamp_decal((Decal){
+            .kind = DECAL_CORPSE,
+            .a    = dying->pos,
+            .sprite = dying->sprite,
+            .flip = dying->flip_texture,
+        });
+        arrdelswap(dying_enemies, i);
+    }
+}
+
+Clip_Frame clip_frame(Anim_State anim) {
+    return CLIP_FRAMES[CLIPS[anim.clip].first + anim.frame];
+}
+
+void draw_sprite_list(void) {
+    for (I32 i = 0; i < arrlen(draw_list.records); i++) {
+        Sprite_Instance *sprite = &draw_list.sprites[(U32)draw_list.records[i]];
+        Vec2 pos = {sprite->pos.x, sprite->pos.y + sprite->frame.offset_y*TILE_UPSCALE_FACTOR};
+        draw_sprite(sprite->frame.sprite, sprite->palette, pos, sprite->flip, sprite->frame.rotation, sprite->tint);
+    }
+}
+
+void push_bar(Vec2 pos, F32 fill, Color color) {
+    Bar_Instance bar = {
+        .rect  = (Rect){pos.x, pos.y, TILE_SIZE, BAR_HEIGHT},
+        .fill  = Clamp(fill, 0.0f, 1.0f),
+        .color = color,
+    };
+    arrput(bars, bar);
+}
+
+void collect_actor_bars(void) {
+    arrsetlen(bars, 0);
+
+    push_bar((Vec2){player.pos.x, player.pos.y + TILE_SIZE + 8}, player.health/100.0f, PAL4);
+    push_bar((Vec2){player.pos.x, player.pos.y + TILE_SIZE + 16}, player.mana/100.0f, PAL0);
+    push_bar((Vec2){apprentice.pos.x, apprentice.pos.y + TILE_SIZE + 8}, apprentice.health/100.0f, PAL4);
+    push_bar((Vec2){apprentice.pos.x, apprentice.pos.y + TILE_SIZE + 16}, apprentice.mana/100.0f, PAL0);
+
+    // Enemies at full health don't need a bar
+    for (int i = 0; i < arrlen(enemies); i++) {
+        if (enemies[i].health >= enemies[i].max_health) continue;
+        push_bar((Vec2){enemies[i].pos.x, enemies[i].pos.y + TILE_SIZE + 8},
+            enemies[i].health/enemies[i].max_health, PAL4);
+    }
+}
+
+// Draws every collected bar as two quads (border, then fill inset by the border) in a single
+// batch on raylib's default white texture, so all bars end up in one draw call
+void draw_bars(void) {
+    rlSetTexture(rlGetTextureIdDefault());
+    for (int i = 0; i < arrlen(bars); i++) {
+        Bar_Instance bar = bars[i];
+        F32 width = bar.rect.width*bar.fill;
+        if (width <= 0.0f) continue;
+
+        Rect quads[2] = {
+            {bar.rect.x, bar.rect.y, width, bar.rect.height},
+            {bar.rect.x + BAR_BORDER, bar.rect.y + BAR_BORDER, width - 2*BAR_BORDER, bar.rect.height - 2*BAR_BORDER},
+        };
+        Color colors[2] = {PAL5, bar.color};
+        int quad_count = (quads[1].width > 0.0f) ? 2 : 1;
+
+        rlCheckRenderBatchLimit(4*quad_count);
+        rlBegin(RL_QUADS);
+            for (int q = 0; q < quad_count; q++) {
+                Rect r = quads[q];
+                rlColor4ub(colors[q].r, colors[q].g, colors[q].b, colors[q].a);
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex2f(r.x, r.y);
+                rlVertex2f(r.x, r.y + r.height);
+                rlVertex2f(r.x + r.width, r.y + r.height);
+                rlVertex2f(r.x + r.width, r.y);
+            }
+        rlEnd();
+    }
+    rlSetTexture(0);
+}
+
+void load_ray_shader(void) {
+    ray_shader.shader          = LoadShaderFromMemory(NULL, RAY_FRAGMENT_SHADER);
+    ray_shader.quad_loc        = GetShaderLocation(ray_shader.shader, "quad");
+    ray_shader.anchor_a_loc    = GetShaderLocation(ray_shader.shader, "anchor_a");
+    ray_shader.anchor_b_loc    = GetShaderLocation(ray_shader.shader, "anchor_b");
+    ray_shader.ring_radius_loc = GetShaderLocation(ray_shader.shader, "ring_radius");
+    ray_shader.pixel_size_loc  = GetShaderLocation(ray_shader.shader, "pixel_size");
+    ray_shader.outer_color_loc = GetShaderLocation(ray_shader.shader, "outer_color");
+    ray_shader.inner_color_loc = GetShaderLocation(ray_shader.shader, "inner_color");
+}
+
+// Draws the activation ring around `to`, both end caps and the beam as one quad.
+// NOTE: Must be called inside BeginMode2D(), the quad is specified in world units
+void draw_spell_ray(Spell_Kind spell, Vec2 from, Vec2 to) {
+    Color outer_color = {0};
+    Color inner_color = {0};
+    switch (spell) {
+    case NO_SPELL: return;
+    case MANA_RAY:
+        outer_color = PAL0;
+        inner_color = PAL1;
+        break;
+    case DEATH_RAY:
+        outer_color = PAL3;
+        inner_color = PAL4;
+        break;
+    default: return;
+    }
+
+    F32 ad = SPELLS[spell].activation_distance;
+    F32 pixel_size = 1.0f/get_world_camera().zoom;
+
+    // Bounds of the ring and of the beam capsule, padded by a pixel for the antialiased edge
+    F32 ring_extent = ad + 2.0f + pixel_size;
+    F32 cap_extent  = 8.0f + pixel_size;
+    Vec2 min = {
+        fminf(to.x - ring_extent, fminf(from.x, to.x) - cap_extent),
+        fminf(to.y - ring_extent, fminf(from.y, to.y) - cap_extent),
+    };
+    Vec2 max = {
+        fmaxf(to.x + ring_extent, fmaxf(from.x, to.x) + cap_extent),
+        fmaxf(to.y + ring_extent, fmaxf(from.y, to.y) + cap_extent),
+    };
+    Rect quad = {min.x, min.y, max.x - min.x, max.y - min.y};
+
+    Vector4 outer = ColorNormalize(outer_color);
+    Vector4 inner = ColorNormalize(inner_color);
+    SetShaderValue(ray_shader.shader, ray_shader.quad_loc, &quad, SHADER_UNIFORM_VEC4);
+    SetShaderValue(ray_shader.shader, ray_shader.anchor_a_loc, &from, SHADER_UNIFORM_VEC2);
+    SetShaderValue(ray_shader.shader, ray_shader.anchor_b_loc, &to, SHADER_UNIFORM_VEC2);
+    SetShaderValue(ray_shader.shader, ray_shader.ring_radius_loc, &ad, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(ray_shader.shader, ray_shader.pixel_size_loc, &pixel_size, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(ray_shader.shader, ray_shader.outer_color_loc, &outer, SHADER_UNIFORM_VEC4);
+    SetShaderValue(ray_shader.shader, ray_shader.inner_color_loc, &inner, SHADER_UNIFORM_VEC4);
+
+    // raylib's 1x1 white texture, its texcoords span 0..1 over the quad
+    Texture2D white = { rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    BeginShaderMode(ray_shader.shader);
+        DrawTexturePro(white, (Rect){0, 0, 1, 1}, quad, (Vec2){0, 0}, 0.0f, WHITE);
+    EndShaderMode();
+}
+
+// Loads the palette shader and builds its LUT from Color_Palette and PALETTE_SWAPS
+void load_palette(void) {
+    Image lut = GenImageColor(PALETTE_LUT_WIDTH, PALETTE_ROW_COUNT, BLANK);
+    for (int row = 0; row < PALETTE_ROW_COUNT; row++) {
+        Palette_Swap swap = PALETTE_SWAPS[row];
+        for (int i = 0; i < ARRAY_LEN(Color_Palette); i++) {
+            Color color = Color_Palette[swap.remap[i]];
+            color.r = (U8)(color.r*swap.brightness/255);
+            color.g = (U8)(color.g*swap.brightness/255);
+            color.b = (U8)(color.b*swap.brightness/255);
+            ImageDrawPixel(&lut, i + 1, row, color);
+        }
+        ImageDrawPixel(&lut, PALETTE_INDEX_WHITE, row, WHITE);
+    }
+    palette_lookup.lut = LoadTextureFromImage(lut);
+    UnloadImage(lut);
+
+    palette_lookup.shader = LoadShaderFromMemory(NULL, PALETTE_FRAGMENT_SHADER);
+    palette_lookup.lut_loc = GetShaderLocation(palette_lookup.shader, "palette");
+    palette_lookup.size_loc = GetShaderLocation(palette_lookup.shader, "palette_size");
+
+    Vec2 size = {PALETTE_LUT_WIDTH, PALETTE_ROW_COUNT};
+    int unit = PALETTE_LUT_TEXTURE_UNIT;
+    SetShaderValue(palette_lookup.shader, palette_lookup.size_loc, &size, SHADER_UNIFORM_VEC2);
+    SetShaderValue(palette_lookup.shader, palette_lookup.lut_loc, &unit, SHADER_UNIFORM_INT);
+
+    // Bound once on its own unit, SetShaderValueTexture() bindings only last until the batch flushes
+    rlActiveTextureSlot(PALETTE_LUT_TEXTURE_UNIT);
+    rlEnableTexture(palette_lookup.lut.id);
+    rlActiveTextureSlot(0);
+}
+
+void unload_palette(void) {
+    UnloadShader(palette_lookup.shader);
+    UnloadTexture(palette_lookup.lut);
+}
+
+// Nearest Color_Palette entry as a palette index, transparent pixels are PALETTE_INDEX_TRANSPARENT
+U8 palette_index(Color color) {
+    if (color.a == 0) return PALETTE_INDEX_TRANSPARENT;
+
+    int best = 0;
+    int best_distance = 0;
+    for (int i = 0; i < ARRAY_LEN(Color_Palette); i++) {
+        int dr = color.r - Color_Palette[i].r;
+        int dg = color.g - Color_Palette[i].g;
+        int db = color.b - Color_Palette[i].b;
+        int distance = dr*dr + dg*dg + db*db;
+        if (i == 0 || distance < best_distance) {
+            best = i;
+            best_distance = distance;
+        }
+    }
+    return (U8)(best + 1);
+}
+
+// Loads an image file and uploads it as palette indices, a quarter of the RGBA size
+Texture2D load_indexed_texture(const char *file_name) {
+    Image image = LoadImage(file_name);
+    Color *pixels = LoadImageColors(image);
+    Image indexed = GenImageColor(image.width, image.height, BLANK);
+    ImageFormat(&indexed, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+
+    U8 *indices = indexed.data;
+    for (int i = 0; i < image.width*image.height; i++) indices[i] = palette_index(pixels[i]);
+
+    Texture2D texture = LoadTextureFromImage(indexed);
+    UnloadImageColors(pixels);
+    UnloadImage(indexed);
+    UnloadImage(image);
+    return texture;
+}
+
+Palette_Row enemy_palette(const Enemy *enemy) {
+    static const Palette_Row variants[ENEMY_PALETTE_VARIANTS] = {
+        PALETTE_ROW_BASE, PALETTE_ROW_ENEMY_A, PALETTE_ROW_ENEMY_B,
     };
-    Vector2 origin = { 0.0f, 0.0f };
+    return variants[(enemy->id/4)%ENEMY_PALETTE_VARIANTS];
+}
+
+// Builds the atlas texture from the generated ATLAS_DATA and copies raylib's default font into
+// the FONT frame, so sprites, icons, the howto panel and text all sample the same texture
+void load_atlas(void) {
+    Image atlas_image = {0};
+
+    atlas_image.format = ATLAS_FORMAT;
+    atlas_image.width = ATLAS_WIDTH;
+    atlas_image.height = ATLAS_HEIGHT;
+    atlas_image.mipmaps = 1;
+    atlas_image.data = ATLAS_DATA;
+
+    Font default_font = GetFontDefault();
+    Rect font_frame = ATLAS_SPRITES[SPRITE_FONT].src;
+    game_font = default_font;
+
+    if (default_font.texture.width <= font_frame.width && default_font.texture.height <= font_frame.height) {
+        atlas_image = ImageCopy(atlas_image);
+        Image font_image = LoadImageFromTexture(default_font.texture);
+        Color *glyph_pixels = LoadImageColors(font_image);
+        U8 *indices = atlas_image.data;
+        for (int y = 0; y < font_image.height; y++) {
+            for (int x = 0; x < font_image.width; x++) {
+                U8 index = glyph_pixels[y*font_image.width + x].a > 0 ? PALETTE_INDEX_WHITE : PALETTE_INDEX_TRANSPARENT;
+                indices[((int)font_frame.y + y)*atlas_image.width + (int)font_frame.x + x] = index;
+            }
+        }
+        UnloadImageColors(glyph_pixels);
+        UnloadImage(font_image);
+
+        game_font.recs = RL_MALLOC(default_font.glyphCount*sizeof(Rectangle));
+        for (int i = 0; i < default_font.glyphCount; i++) {
+            game_font.recs[i] = default_font.recs[i];
+            game_font.recs[i].x += font_frame.x;
+            game_font.recs[i].y += font_frame.y;
+        }
+        atlas = LoadTextureFromImage(atlas_image);
+        UnloadImage(atlas_image);
+        game_font.texture = atlas;
+    } else {
+        TraceLog(LOG_WARNING, "Default font doesn't fit the atlas, text keeps its own texture");
+        atlas = LoadTextureFromImage(atlas_image);
+    }
+}
+
+void unload_atlas(void) {
+    if (game_font.texture.id == atlas.id) RL_FREE(game_font.recs);
+    UnloadTexture(atlas);
+}
+
+// Same sizing and spacing rules as DrawText(), but with the font copy living in the atlas
+void draw_text(const char *text, int x, int y, int font_size, Color color) {
+    const int default_font_size = 10;
+    if (font_size < default_font_size) font_size = default_font_size;
+    DrawTextEx(game_font, text, (Vec2){(F32)x, (F32)y}, (F32)font_size, (F32)(font_size/default_font_size), color);
+}
+
+int measure_text(const char *text, int font_size) {
+    const int default_font_size = 10;
+    if (font_size < default_font_size) font_size = default_font_size;
+    return (int)MeasureTextEx(game_font, text, (F32)font_size, (F32)(font_size/default_font_size)).x;
+}
 
+// Draws a sprite at its upscaled tile size
+void draw_sprite(Sprite_Id id, Palette_Row palette, Vec2 position, Flip_Texture flip, F32 rotation, Color tint)
+{
+    Atlas_Sprite sprite = ATLAS_SPRITES[id];
+    Rect frame = {position.x, position.y, sprite.frame.x*TILE_UPSCALE_FACTOR, sprite.frame.y*TILE_UPSCALE_FACTOR};
+    draw_sprite_frame(id, palette, frame, flip, rotation, tint);
+}
+
+// Draws a sprite so its untrimmed frame covers `frame`, rotated in degrees around the frame center.
+// The palette row rides in the v texcoord, whole atlas heights below the sprite (see PALETTE_FRAGMENT_SHADER)
+void draw_sprite_frame(Sprite_Id id, Palette_Row palette, Rect frame, Flip_Texture flip, F32 rotation, Color tint)
+{
+    Atlas_Sprite sprite = ATLAS_SPRITES[id];
+    Rect src = sprite.src;
+    src.y += (F32)palette*atlas.height;
+    Vec2 offset = sprite.offset;
+    Vec2 scale = {frame.width/sprite.frame.x, frame.height/sprite.frame.y};
+
+    // Flipping mirrors the trimmed rect inside the frame too
     switch(flip){
         case NO_FLIP: break;
         case FLIP_X:
+            offset.x = sprite.frame.x - offset.x - src.width;
             src.width *= -1;
             break;
         case FLIP_Y:
+            offset.y = sprite.frame.y - offset.y - src.height;
             src.height *= -1;
             break;
         case FLIP_XY:
+            offset.x = sprite.frame.x - offset.x - src.width;
+            offset.y = sprite.frame.y - offset.y - src.height;
             src.width *= -1;
             src.height *= -1;
             break;
     }
-    DrawTexturePro(texture, src, dst, origin, 0.0f, tint);
+
+    Vec2 center = {frame.x + frame.width/2, frame.y + frame.height/2};
+    Rect dst = {
+        center.x,
+        center.y,
+        fabsf(src.width)*scale.x,
+        fabsf(src.height)*scale.y,
+    };
+    Vec2 origin = {
+        center.x - (frame.x + offset.x*scale.x),
+        center.y - (frame.y + offset.y*scale.y),
+    };
+    DrawTexturePro(atlas, src, dst, origin, rotation, tint);
 }
@@ -41,6 +41,14 @@ typedef enum {
     SPELL_KIND_COUNT,
 } Spell_Kind;
 
+// Playback cursor into CLIPS/CLIP_FRAMES, small enough to keep one per enemy
+typedef struct Anim_State {
+    U8 clip;            // Clip_Id
+    U8 frame;           // Keyframe inside the clip
+    U8 ticks;           // Ticks left on the keyframe
+    U8 finished;        // A non looping clip is holding its last keyframe
+} Anim_State;
+
 typedef struct Player {
     Vec2 pos;
     F32  speed;
@@ -59,6 +67,7 @@ typedef struct Player {
     Vec2 ray_anchor;
 
     Flip_Texture flip_texture;
+    Anim_State   anim;
 } Player;
 
 typedef struct Spell{
@@ -86,6 +95,7 @@ typedef struct Apprentice {
     Vec2 ray_anchor;
 
     Flip_Texture flip_texture;
+    Anim_State   anim;
 
 } Apprentice;
 
@@ -99,8 +109,509 @@ typedef struct Enemy {
     F32 max_health;
 
     Flip_Texture flip_texture;
+    Anim_State   anim;
 } Enemy;
 
+// Enemies bucketed into TILE_SIZE cells by a counting sort, rebuilt every frame before they move, so the
+// separation force only looks at the 3x3 cells around each enemy, see update_enemy_separation().
+// Cell c holds order[start[c] .. start[c + 1])
+typedef struct Enemy_Grid {
+    U32  *start;            // Offsets into order, the cell past the grid holds enemies at NaN positions
+    U32  *order;            // Enemy indices, by cell
+    U32  *cell;             // Cell of each enemy
+    Vec2 *separation;       // Force on each enemy, kept in step with enemies by update_gameplay()
+    F32   ms;               // CPU time of the last update_enemy_separation()
+} Enemy_Grid;
+
+// Scales the world render target to keep the frame cost inside the budget
+typedef struct Dynamic_Resolution {
+    F32 scale;              // Current world render scale, fraction of native resolution
+    F32 scaled_ms;          // Smoothed cost that follows the world target size, see update_dynamic_resolution()
+    F32 fixed_ms;           // Smoothed cost of the rest of the frame
+    F32 over_budget_time;   // Seconds spent continuously above the high watermark
+    F32 under_budget_time;  // Seconds spent continuously below the low watermark
+    F32 cooldown;           // Seconds until the scale is allowed to change again
+} Dynamic_Resolution;
+
+// Rows of the palette LUT, every row maps the 8 palette indices to its own colors
+typedef enum Palette_Row {
+    PALETTE_ROW_BASE,
+    PALETTE_ROW_HIT,        // Invincibility flash, replaces the old *_HIT sprites
+    PALETTE_ROW_CORPSE,     // Darkened for baked corpses
+    PALETTE_ROW_ENEMY_A,
+    PALETTE_ROW_ENEMY_B,
+    PALETTE_ROW_COUNT,
+} Palette_Row;
+
+typedef struct Palette_Swap {
+    U8 remap[8];            // Color_Palette index each index is drawn with
+    U8 brightness;          // 255 keeps the colors as they are
+} Palette_Swap;
+
+// Textures stored as palette indices (R8) and the shader resolving them through the LUT
+typedef struct Palette {
+    Shader shader;
+    Texture2D lut;          // PALETTE_LUT_WIDTH x PALETTE_ROW_COUNT colors
+    int lut_loc;
+    int size_loc;
+} Palette;
+
+// Enemy playing its death clip, stamped into the decal layer once the clip ends
+typedef struct Dying_Enemy {
+    Vec2 pos;
+    Sprite_Id sprite;
+    Palette_Row palette;
+    Flip_Texture flip_texture;
+    Anim_State anim;
+} Dying_Enemy;
+
+typedef struct Sprite_Instance {
+    Clip_Frame frame;
+    Palette_Row palette;
+    Vec2 pos;
+    Flip_Texture flip;
+    Color tint;
+} Sprite_Instance;
+
+// Sprites of a frame, drawn back to front by quantized y.
+// Records pack the 16 bit sort key above the sprite index: (key << 32) | index
+typedef struct Draw_List {
+    Sprite_Instance *sprites;
+    U16 *keys;
+    U64 *records;
+    U64 *scratch;
+    U32 *prev_order;    // Sorted sprite indices of last frame, reused as the starting order
+} Draw_List;
+
+// Fixed capacity structure of arrays, allocated once in init_particles()
+typedef struct Particle_System {
+    F32 *pos_x;
+    F32 *pos_y;
+    F32 *vel_x;
+    F32 *vel_y;
+    F32 *life;          // Seconds left, the particle dies at zero
+    F32 *lifetime;      // Seconds it was spawned with, used to shrink it over time
+    U8  *color;         // Color_Palette index
+
+    I32 count;
+    I32 capacity;
+    I32 limit;          // Runtime cap <= capacity, emitters drop particles above it, see set_particle_limit()
+    U32 rng;
+    Rect palette_texels[8];     // One atlas texel of each palette color, particles are drawn from these
+} Particle_System;
+
+typedef enum {
+    DECAL_CORPSE = 0,
+    DECAL_SCORCH,
+} Decal_Kind;
+
+// Stamp waiting to be baked into the decal layer at the start of the next draw
+typedef struct Decal {
+    Decal_Kind kind;
+    Vec2 a;             // Corpse position, or scorch start
+    Vec2 b;             // Scorch end
+    Sprite_Id sprite;
+    Flip_Texture flip;
+} Decal;
+
+// Persistent marks on the floor, baked once into a render texture at background resolution
+typedef struct Decal_Layer {
+    RenderTexture2D texture;
+    Decal *pending;
+    I32  fade_steps;    // Wave changes not yet applied to the layer
+    bool clear;
+    F32  scorch_timer;
+} Decal_Layer;
+
+// Light accumulation at a fraction of the world target resolution, multiplied over the world
+typedef struct Light_Buffer {
+    RenderTexture2D texture;
+    Texture2D falloff;      // Radial gradient, every light is one additive quad of it
+} Light_Buffer;
+
+#define BLOOM_LEVELS 3
+
+typedef enum {
+    POST_BLOOM = 0,
+    POST_VIGNETTE,
+    POST_PALETTE,
+    POST_PASS_COUNT,
+} Post_Pass;
+
+// Post-processing of the world target. Bloom runs as its own passes over a downsample pyramid,
+// vignette and palette quantization are folded into the composite draw that presents the target.
+typedef struct Post_Process {
+    bool enabled[POST_PASS_COUNT];
+    F32  bloom_ms;              // CPU time of the bloom passes last frame
+    F32  composite_ms;          // CPU time of the composite draw last frame, vignette, palette and bloom add together
+    F64  composite_start;
+    bool composite_active;
+
+    RenderTexture2D bloom_down[BLOOM_LEVELS];   // 1/2, 1/4, 1/8 of the world target
+    RenderTexture2D bloom_temp[BLOOM_LEVELS];   // Horizontal blur result of each level
+
+    Shader threshold_shader;
+    Shader blur_shader;
+    Shader composite_shader;
+    int threshold_loc;
+    int direction_loc;
+    int bloom_loc;
+    int bloom_intensity_loc;
+    int vignette_strength_loc;
+    int palette_enabled_loc;
+    int palette_loc;
+} Post_Process;
+
+// Resources passes of the render graph read and write, as bits
+typedef enum Render_Resource {
+    RESOURCE_DECALS     = 1 << 0,
+    RESOURCE_LIGHTS     = 1 << 1,
+    RESOURCE_WORLD      = 1 << 2,   // The dynamic resolution `target`
+    RESOURCE_BLOOM      = 1 << 3,
+    RESOURCE_BACKBUFFER = 1 << 4,
+} Render_Resource;
+
+typedef enum Render_Pass_Id {
+    PASS_DECALS,
+    PASS_LIGHTS,
+    PASS_WORLD,
+    PASS_LIGHT_COMPOSITE,
+    PASS_BLOOM,
+    PASS_PRESENT,
+    PASS_TITLE,
+    PASS_HUD,
+    PASS_DEBUG,
+    PASS_ENDING,
+    PASS_COUNT,
+} Render_Pass_Id;
+
+// What the graph binds around a pass, passes with RENDER_TARGET_NONE bind their own
+typedef enum Render_Target {
+    RENDER_TARGET_NONE,
+    RENDER_TARGET_WORLD,
+    RENDER_TARGET_BACKBUFFER,
+} Render_Target;
+
+typedef struct Render_Pass {
+    Render_Pass_Id id;
+    U32  reads;             // Render_Resource bits
+    U32  writes;
+    Render_Target target;
+    bool palette;           // Drawn through the palette shader
+    void (*execute)(void);
+
+    bool culled;
+    bool opens_group;       // Consecutive passes with the same target and shader share one bind
+    bool closes_group;
+} Render_Pass;
+
+typedef struct Render_Pass_Stats {
+    bool culled;
+    bool gpu_timed;         // Opens a bind group, gpu_ms covers the whole group
+    F32  cpu_ms;
+    F32  gpu_ms;            // From GPU_TIMER_FRAMES frames ago
+    U32  draw_calls;        // Draws flushed when a merged group closes count on its last pass
+    U32  vertices;
+    U32  texture_binds;
+} Render_Pass_Stats;
+
+// Declared again every frame by build_render_graph(), in execution order
+typedef struct Render_Graph {
+    Render_Pass passes[PASS_COUNT];
+    I32  count;
+    U32  persistent;        // Resources still valid from an earlier frame, e.g. the world while paused
+    I32  groups;            // Binds after merging
+    bool presenting;        // BeginDrawing() was called this frame
+    Render_Pass_Stats stats[PASS_COUNT];
+} Render_Graph;
+
+#define GPU_TIMER_FRAMES 3      // Query sets in flight, results are read back this many frames later
+
+// GL_TIME_ELAPSED queries around each bind group of the render graph, indexed by the pass that
+// opens the group. Results are only read once available, so the CPU never waits on the GPU
+typedef struct Gpu_Timers {
+    bool supported;
+    U32  frame;
+    U32  queries[GPU_TIMER_FRAMES][PASS_COUNT];
+    bool issued[GPU_TIMER_FRAMES][PASS_COUNT];
+    F32  gpu_ms[PASS_COUNT];    // Latest result of each group
+} Gpu_Timers;
+
+typedef enum Pacer_Mode {
+    PACER_FREE_RUN,         // Timed by the pacer at PACER_TARGET_FPS, vsync off
+    PACER_VSYNC,            // Aligned to the monitor refresh, the pacer only catches a missing vsync
+} Pacer_Mode;
+
+// Sleeps until just before each frame deadline, then spins the rest, replacing SetTargetFPS()
+typedef struct Frame_Pacer {
+    Pacer_Mode mode;
+    F64 period;             // Seconds per frame
+    F64 deadline;           // When the next frame should start
+    F64 spin_margin;        // Sleep stops this much before the deadline, from the measured sleep granularity
+
+    U32 frames;
+    U32 late_frames;        // Started more than PACER_LATE_THRESHOLD after the deadline
+    F64 error_sum;          // Seconds, positive is late
+    F64 error_sq_sum;
+    F64 max_error;
+    F64 spin_time;          // Seconds spent spinning, the CPU cost of precision
+} Frame_Pacer;
+
+// Static screens (title, ending, pause) are presented once and then only polled for input
+typedef struct Idle_Presenter {
+    bool presented;         // The last frame was a complete static frame
+    F64  present_time;      // When it was presented
+} Idle_Presenter;
+
+#define FRAME_HISTOGRAM_SUB_BITS 4                  // 16 linear buckets per power of two, within 6.25%
+#define FRAME_HISTOGRAM_SUB_BUCKETS (1 << FRAME_HISTOGRAM_SUB_BITS)
+#define FRAME_HISTOGRAM_BUCKETS ((32 - FRAME_HISTOGRAM_SUB_BITS + 1)*FRAME_HISTOGRAM_SUB_BUCKETS)
+#define FRAME_STUTTER_LEVELS 3
+#define TELEMETRY_BUFFER_SIZE 16384
+#define FLIGHT_RECORDER_FRAMES 600              // 10 seconds at 60 Hz, about 60 KB
+#define FLIGHT_RECORDER_AFTER_FRAMES 120
+#define FRAME_WORST_COUNT 8
+#define STRESS_STEP_COUNT 9
+
+typedef enum Latency_Mode {
+    LATENCY_DEFAULT,        // EndDrawing() polls input right after the swap, then the pacer sleeps
+    LATENCY_LOW,            // Swap, glFinish() with USE_GLAD_HOOKS, sleep, then poll, with vsync timed to finish at the vblank
+    LATENCY_LATE_LATCH,     // As low, but the poll moves after the simulation and only the player uses it
+    LATENCY_MODE_COUNT,
+} Latency_Mode;
+
+// Input-to-present latency: from the poll that delivered an input event to the next buffer swap.
+// The display adds its scanout on top, which can't be measured from here
+typedef struct Input_Latency {
+    Latency_Mode mode;
+    bool polled;            // Input was polled during this frame
+    F64  input_time;        // Poll that delivered input not presented yet, 0 when none
+    F64  present_time;      // Last swap
+    F64  work;              // Peak-held seconds from frame start to swap, the low latency lead
+    U32  samples;
+    F64  sum;
+    F64  max;
+    F64  last;
+} Input_Latency;
+
+typedef struct Worst_Frame {
+    F32 ms;
+    F64 time;               // Session time at the start of the frame
+    I32 wave_id;
+    I32 enemy_count;
+} Worst_Frame;
+
+// Times in microseconds, bucketed like HdrHistogram: values below FRAME_HISTOGRAM_SUB_BUCKETS
+// are exact, above that every power of two is split linearly
+typedef struct Time_Histogram {
+    U32 buckets[FRAME_HISTOGRAM_BUCKETS];
+    U32 count;
+    F64 total_ms;
+    F32 max_ms;
+} Time_Histogram;
+
+// Whole-session gameplay frame times
+typedef struct Frame_Stats {
+    Time_Histogram times;
+    U32 stutters[FRAME_STUTTER_LEVELS];     // Frames longer than FRAME_STUTTER_MS[i]
+    Worst_Frame worst[FRAME_WORST_COUNT];   // Longest first
+    I32 worst_count;
+    F64 last_start;         // A frame's length is known when the next one starts
+} Frame_Stats;
+
+// Gameplay frames of one wave, or of one second of play
+typedef struct Telemetry_Window {
+    Time_Histogram update;
+    Time_Histogram draw;
+    F64 seconds;            // Summed frame times, pauses excluded
+    U32 draw_calls;
+    U32 enemy_peak;
+    U32 kills;
+    I64 memory_peak;
+} Telemetry_Window;
+
+// One CSV row per wave, and per second of play when per_second is set. Rows are formatted into
+// the buffer and written when it fills or on exit, the frame only pays for an snprintf()
+typedef struct Telemetry {
+    bool  per_second;
+    FILE *file;
+    I32   wave_id;          // Wave of the open window
+    U32   rows;
+    Telemetry_Window wave;
+    Telemetry_Window second;
+    I32   length;
+    char  buffer[TELEMETRY_BUFFER_SIZE];
+} Telemetry;
+
+// Frames of one enemy count of the stress test
+typedef struct Stress_Step {
+    I32 enemies;
+    Time_Histogram frames;  // Frame start to present, the pacer wait excluded
+    F64 update_ms;          // Summed over the frames
+    F64 separation_ms;      // Part of update_ms
+    F64 draw_ms;
+} Stress_Step;
+
+// Started with --stress: gameplay without the title, the player can't die and the death ray is kept
+// cast while the enemy count steps through STRESS_ENEMY_COUNTS. Quits after writing the report
+typedef struct Stress_Test {
+    bool enabled;
+    bool finished;
+    I32  step;
+    F64  step_start;
+    I32  spawned;           // Next enemy id, keeps the four kinds mixed
+    Stress_Step steps[STRESS_STEP_COUNT];
+} Stress_Test;
+
+// Gameplay numbers balance_sim.c sweeps, the game always plays with the defaults
+typedef struct Balance {
+    F32 death_ray_damage;   // Per frame, on every enemy the ray touches
+    F32 enemy_damage;       // Per hit, the player takes it times half the wave number
+    F32 enemy_speed;        // Of newly spawned enemies
+    F32 spell_cost_scale;   // Multiplies every SPELLS mana cost
+} Balance;
+
+#define AUTOPILOT_MAX_KEYS 8
+
+// Started with --autopilot: plays unattended, restarting after every game over. Its keys are held
+// or pressed for one frame, key_down() and key_pressed() report them like the keyboard's
+typedef struct Autopilot {
+    bool enabled;
+    bool recharging;        // Mana ray until the apprentice is charged again
+    I32  lap_leg;           // Corner of the lap being walked to, see steer_autopilot()
+    I32  down_count;
+    I32  pressed_count;
+    int  down[AUTOPILOT_MAX_KEYS];
+    int  pressed[AUTOPILOT_MAX_KEYS];
+    I32  games;
+    I32  best_wave;
+    F64  game_start;
+} Autopilot;
+
+typedef enum Flight_Section {
+    FLIGHT_MUSIC,           // UpdateMusicStream(), stream refills
+    FLIGHT_UPDATE,
+    FLIGHT_DRAW,            // Building and executing the render graph
+    FLIGHT_PRESENT,         // EndDrawing(), the buffer swap and input polling
+    FLIGHT_PACE,
+    FLIGHT_SECTION_COUNT,
+} Flight_Section;
+
+// Events counted while a frame runs
+typedef struct Frame_Counters {
+    U16 deaths;
+    U16 spawns;
+    U16 sounds;
+    U16 allocations;        // Tracked allocations, see tracked_malloc()
+} Frame_Counters;
+
+typedef struct Flight_Frame {
+    U32 frame;
+    F32 time;               // Session seconds at the frame start
+    F32 frame_ms;           // Start to start
+    F32 section_ms[FLIGHT_SECTION_COUNT];
+    F32 pass_ms[PASS_COUNT];
+    U32 draw_calls;
+    U32 particles;
+    U16 enemies;
+    I16 wave_id;
+    U8  screen;
+    bool hitch;
+    Frame_Counters counters;
+} Flight_Frame;
+
+// Always-on ring of the last FLIGHT_RECORDER_FRAMES frames, no allocation. A gameplay frame over
+// threshold_ms schedules a dump once FLIGHT_RECORDER_AFTER_FRAMES more frames are recorded,
+// so the file holds the seconds before and after the hitch
+typedef struct Flight_Recorder {
+    Flight_Frame frames[FLIGHT_RECORDER_FRAMES];
+    U32 count;              // Frames recorded, the next one goes to count % FLIGHT_RECORDER_FRAMES
+    Flight_Frame current;   // Frame in progress, committed when the next one starts
+    F64 last_start;
+    F32 threshold_ms;
+    I32 dump_countdown;     // Frames left before a pending dump, 0 when none is pending
+    I32 dumps;
+    bool skip_next;         // The frame that wrote a dump is slow because of it
+} Flight_Recorder;
+
+// Part of the game charged for an allocation, whichever was set with set_alloc_tag() when it was made.
+// Only the game's own heap is seen: stb_ds arrays and RL_* calls in raylib_game.c. Textures, sounds,
+// TextFormat() buffers and the rest of what prebuilt raylib allocates are not in any tag
+typedef enum Alloc_Tag {
+    ALLOC_GENERAL,
+    ALLOC_LOADING,              // Game side tables built while loading, e.g. the font glyph rectangles
+    ALLOC_GAMEPLAY,
+    ALLOC_PARTICLES,
+    ALLOC_RENDER,
+    ALLOC_TAG_COUNT,
+} Alloc_Tag;
+
+typedef struct Alloc_Stats {
+    I64 live_bytes;
+    I64 peak_bytes;
+    U32 allocations;            // Whole session, reallocations included
+    U32 frame_allocations;      // Frame in progress
+    U32 last_frame_allocations;
+} Alloc_Stats;
+
+// Prefix of every tracked block, 16 bytes so the block keeps malloc's alignment
+typedef struct Alloc_Header {
+    U64 size;
+    U64 tag;
+} Alloc_Header;
+
+typedef struct Alloc_Tracker {
+    Alloc_Stats tags[ALLOC_TAG_COUNT];
+    Alloc_Tag tag;
+    I64 live_bytes;
+    I64 peak_bytes;
+    U32 gameplay_frames;
+    U32 allocating_frames;      // Gameplay frames that allocated, zero in a steady state
+} Alloc_Tracker;
+
+#define TRACE_MAX_EVENTS 16384
+#define TRACE_FRAME_HEADROOM 512        // Events a frame may add, the buffer is flushed before it can overflow
+
+// Complete event ("ph": "X") of the Chrome trace-event format
+typedef struct Trace_Event {
+    const char *name;       // String literal, only the pointer is stored
+    F64 start;              // GetTime() seconds, monotonic
+    F64 end;
+} Trace_Event;
+
+// Zones recorded between start_trace() and stop_trace(), streamed to a Chrome trace JSON file that
+// chrome://tracing and Perfetto open. The game is single threaded, so one buffer needs no atomics,
+// and it is only flushed between frames when no zone is open
+typedef struct Tracer {
+    bool  enabled;
+    bool  toggle;           // Start or stop at the next frame boundary
+    FILE *file;
+    I32   captures;
+    F64   origin;           // Timestamps are written relative to the start of the capture
+    U32   written;
+    U32   dropped;          // Zones begun with the buffer full
+    I32   count;
+    Trace_Event events[TRACE_MAX_EVENTS];
+} Tracer;
+
+// One health or mana bar, the frame is drawn inside `rect` shrunk to the fill ratio
+typedef struct Bar_Instance {
+    Rect  rect;
+    F32   fill;
+    Color color;
+} Bar_Instance;
+
+typedef struct Ray_Shader {
+    Shader shader;
+    int quad_loc;
+    int anchor_a_loc;
+    int anchor_b_loc;
+    int ring_radius_loc;
+    int pixel_size_loc;
+    int outer_color_loc;
+    int inner_color_loc;
+} Ray_Shader;
+
 static Color Color_Palette[8] = {
     {  73,  84,  53, 255 },
     { 138, 142,  72, 255 },
@@ -112,12 +623,45 @@ static Color Color_Palette[8] = {
     { 144, 124, 104, 255 },
 };
 
+const Palette_Swap PALETTE_SWAPS[PALETTE_ROW_COUNT] = {
+    [PALETTE_ROW_BASE]    = {{0, 1, 2, 3, 4, 5, 6, 7}, 255},
+    [PALETTE_ROW_HIT]     = {{4, 4, 4, 4, 4, 5, 4, 4}, 255},
+    [PALETTE_ROW_CORPSE]  = {{0, 1, 2, 3, 4, 5, 6, 7}, 150},
+    [PALETTE_ROW_ENEMY_A] = {{6, 3, 2, 1, 4, 5, 0, 7}, 255},
+    [PALETTE_ROW_ENEMY_B] = {{0, 7, 2, 4, 3, 5, 6, 2}, 255},
+};
+
 const Spell SPELLS[] = {
     [NO_SPELL]  = {0.0f, 0.0f, 0.0f},
     [MANA_RAY]  = {20.0f, 1.0f, 500.0f},
     [DEATH_RAY] = {20.0f, 2.0f, 500.0f},
 };
 
+const F32 FRAME_STUTTER_MS[FRAME_STUTTER_LEVELS] = { 16.6f, 33.3f, 50.0f };   // One, two and three missed 60 Hz frames
+
+const I32 STRESS_ENEMY_COUNTS[STRESS_STEP_COUNT] = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000 };
+
+const char *const ALLOC_TAG_NAMES[ALLOC_TAG_COUNT] = {
+    [ALLOC_GENERAL]   = "general",
+    [ALLOC_LOADING]   = "loading",
+    [ALLOC_GAMEPLAY]  = "gameplay",
+    [ALLOC_PARTICLES] = "particles",
+    [ALLOC_RENDER]    = "render",
+};
+
+const char *const RENDER_PASS_NAMES[PASS_COUNT] = {
+    [PASS_DECALS]          = "decals",
+    [PASS_LIGHTS]          = "lights",
+    [PASS_WORLD]           = "world",
+    [PASS_LIGHT_COMPOSITE] = "light composite",
+    [PASS_BLOOM]           = "bloom",
+    [PASS_PRESENT]         = "present",
+    [PASS_TITLE]           = "title",
+    [PASS_HUD]             = "hud",
+    [PASS_DEBUG]           = "debug",
+    [PASS_ENDING]          = "ending",
+};
+
 
 #define PAL0 Color_Palette[0]
 #define PAL1 Color_Palette[1]
@@ -130,7 +674,7 @@ const Spell SPELLS[] = {
 
 #define TILE_SIZE_ORIGINAL 16
 #define TILE_UPSCALE_FACTOR 3
-#define TILE_SIZE TILE_SIZE_ORIGINAL*TILE_UPSCALE_FACTOR
+#define TILE_SIZE (TILE_SIZE_ORIGINAL*TILE_UPSCALE_FACTOR)
 
 #define SPRITE_CENTER(pos) ((Vec2){(pos).x + TILE_SIZE/2, (pos).y + TILE_SIZE/2})
 
@@ -139,18 +683,227 @@ const Spell SPELLS[] = {
 #define DEATH_RAY_DAMAGE 0.5f
 #define MANA_RAY_MANA_PER_SECOND 2.0f
 #define ENEMY_DAMAGE 1.0f
+#define ENEMY_SPEED (TILE_SIZE*1.5f)
 #define ENEMY_MANA_BURN 0.1f
+
+#define ENEMY_GRID_SIZE 30                  // Cells per side, one per map tile, enemies off the map use the edge cells
+#define ENEMY_GRID_CELLS (ENEMY_GRID_SIZE*ENEMY_GRID_SIZE)
+#define ENEMY_GRID_MIN_ENEMIES 32           // Fewer are cheaper to compare pairwise than to sort into cells
+#define DRAW_SORT_Y_OFFSET 4096.0f        // Keeps sprites spawned outside the map above zero
+#define DRAW_SORT_Y_STEPS_PER_UNIT 4.0f     // Quarter unit precision, 16 bit keys cover y < 12288
+#define DRAW_SORT_INSERTION_BUDGET 4096     // Element moves allowed before falling back to radix
+
+#define MAX_PARTICLES 65536
+#define PARTICLE_DRAG 3.0f
+#define PARTICLE_SIZE 6.0f
+#define DEATH_BURST_PARTICLES 48
+#define RAY_HIT_PARTICLES 1
+
+#define DECAL_SCORCH_INTERVAL 0.1f
+#define DECAL_SCORCH_THICKNESS 4.0f     // In background pixels
+#define DECAL_WAVE_FADE 0.5f            // Decals keep this much of their opacity per new wave
+
+#define LIGHT_BUFFER_DIVISOR 4
+#define LIGHT_AMBIENT (Color){ 175, 165, 160, 255 }
+#define LIGHT_CASTER_RADIUS (TILE_SIZE*3.0f)
+#define LIGHT_CASTER_COLOR (Color){ 80, 70, 55, 255 }
+#define LIGHT_RAY_WIDTH (TILE_SIZE*1.5f)
+
+#define BLOOM_THRESHOLD 0.75f
+#define BLOOM_INTENSITY 0.6f
+#define VIGNETTE_STRENGTH 0.35f
+
+#define BAR_HEIGHT 8.0f
+#define BAR_BORDER 2.0f
+
+#define PALETTE_INDEX_TRANSPARENT 0     // Color_Palette[i] is index i + 1
+#define PALETTE_INDEX_WHITE 255         // Font glyphs, and raylib's white texture reads as this
+#define PALETTE_LUT_WIDTH 256
+#define PALETTE_LUT_TEXTURE_UNIT 7      // Past the units rlgl rebinds every batch, the LUT stays bound
+#define ENEMY_PALETTE_VARIANTS 3
+
+#define PACER_TARGET_FPS 60
+#define PACER_CALIBRATION_SAMPLES 8
+#define PACER_MIN_SPIN_MARGIN 0.0005    // Seconds
+#define PACER_MAX_SPIN_MARGIN 0.004
+#define PACER_LATE_THRESHOLD 0.001
+
+#define IDLE_POLL_INTERVAL (1.0/60.0)   // Seconds slept between input polls on a static screen
+#define IDLE_REPRESENT_INTERVAL 1.0     // Seconds between re-presents of a static frame
+#define MAX_FRAME_DT 0.1f               // Longest step the simulation takes, e.g. after a static stretch
+
+#define LATENCY_WORK_DECAY 0.98         // Per frame, the peak-held work time forgets a spike in about a second
+#define LATENCY_WORK_MARGIN 0.002       // Seconds of slack before the vblank in the low latency modes
+
+#define FRAME_STATS_FILE "frame_stats.json"
+#define FRAME_STUTTER_SLACK_MS 1.0f     // Paced 60 Hz frames land just past 16.67 ms, they are not stutter
+
+#define TRACE_FILE_FORMAT "trace_%02i.json"
+#define TELEMETRY_FILE "telemetry.csv"
+#define TELEMETRY_MAX_ROW 512           // The buffer is flushed before a row could overflow it
+#define HITCH_FILE_FORMAT "hitch_%02i.csv"
+#define STRESS_REPORT_FILE "stress_report.csv"
+#define STRESS_SETTLE_SECONDS 1.0       // Not recorded, new enemies are still walking in
+#define STRESS_HOLD_SECONDS 4.0
+#define STRESS_MIN_FRAMES 5             // Steps slower than the hold time still get this many frames
+#define STRESS_SPAWN_RADIUS 500.0f
+#define STRESS_SPAWN_ANGLE 2.399963229728653    // Golden angle in radians, spreads spawns evenly around the player
+#define AUTOPILOT_DANGER_RADIUS (TILE_SIZE*3.0f)  // Enemies closer than this push the player away
+#define AUTOPILOT_DANGER_WEIGHT 2.0f
+#define AUTOPILOT_LAP_AHEAD 440.0f      // Below the spells' 500 activation distance
+#define AUTOPILOT_LAP_BEHIND 450.0f
+#define AUTOPILOT_LAP_OFFSET 80.0f      // Enemies on the straight stay clear of the apprentice's sprite
+#define AUTOPILOT_LAP_WIDTH 350.0f
+#define AUTOPILOT_WAYPOINT_RADIUS 40.0f
+#define AUTOPILOT_HOLD_RADIUS 108.0f    // Leaves the straight once the nearest enemy is this close
+#define AUTOPILOT_EDGE_MARGIN 0.9f      // Fraction of the half map where the edges start pushing back
+#define AUTOPILOT_EDGE_WEIGHT 2.0f
+#define AUTOPILOT_DEADZONE 0.2f
+#define AUTOPILOT_AXIS_THRESHOLD 0.38f  // sin(22.5 degrees), steering maps to 8 directions
+#define AUTOPILOT_RAY_IDLE 200.0f       // No enemy this close to the ray, it recharges the apprentice
+#define AUTOPILOT_RAY_BUSY 60.0f        // Just outside the ray's 48 px reach
+#define AUTOPILOT_RECHARGE_BELOW 0.2f
+#define AUTOPILOT_RECHARGE_ABOVE 0.9f
+#define AUTOPILOT_CAST_ABOVE 0.9f       // Player mana to reach before casting again after a spell dropped
+#define FLIGHT_RECORDER_THRESHOLD_MS 50.0f     // Default, Flight_Recorder.threshold_ms can change at runtime
+
+#define ANIM_TICK_RATE 12               // Animation ticks per second, clip keyframes last whole ticks
+
+#define DYNRES_MIN_SCALE 0.5f
+#define DYNRES_MAX_SCALE 1.0f
+#define DYNRES_SCALE_STEP 0.125f
+#define DYNRES_BUDGET_MS 16.6f
+#define DYNRES_HIGH_WATERMARK 0.9f      // Downscale above 90% of budget...
+#define DYNRES_LOW_WATERMARK 0.6f       // ...upscale only below 60%
+#define DYNRES_DOWNSCALE_DELAY 0.25f
+#define DYNRES_UPSCALE_DELAY 2.0f
+#define DYNRES_COOLDOWN 1.0f
+#define DYNRES_SMOOTHING 0.1f
+#define DYNRES_MIN_SCALED_SHARE 0.25f   // Downscale only if the scaled part is at least this share of the frame
+#define DYNRES_CHECK_SECONDS 10.0f      // Simulated time of check_dynamic_resolution()
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 static void UpdateDrawFrame(void);      // Update and Draw one frame
 void init_gameplay(void);
 void update_gameplay(void);
+void update_enemy_separation(void);
 void draw_gameplay(void);
 void draw_ui(void);
 void draw_debug_ui(void);
-Rect get_atlas(int row, int col);
-void draw_sprite(Texture2D texture, Rectangle src, Vector2 position, Flip_Texture flip, Color tint);
+void load_palette(void);
+void unload_palette(void);
+U8 palette_index(Color color);
+Texture2D load_indexed_texture(const char *file_name);
+Palette_Row enemy_palette(const Enemy *enemy);
+void load_atlas(void);
+void unload_atlas(void);
+void draw_sprite(Sprite_Id id, Palette_Row palette, Vec2 position, Flip_Texture flip, F32 rotation, Color tint);
+void draw_sprite_frame(Sprite_Id id, Palette_Row palette, Rect frame, Flip_Texture flip, F32 rotation, Color tint);
+void draw_text(const char *text, int x, int y, int font_size, Color color);
+int  measure_text(const char *text, int font_size);
 void spawn_next_wave(int wave_id);
+void split_frame_cost(F32 cpu_ms, F32 present_ms, bool gpu_timed, bool vsync, F32 *scaled_ms, F32 *fixed_ms);
+F32  step_dynamic_resolution(Dynamic_Resolution *state, F32 dt, F32 scaled_ms, F32 fixed_ms);
+void update_dynamic_resolution(F32 cpu_ms, F32 present_ms);
+bool check_dynamic_resolution(void);
+Camera2D get_world_camera(void);
+void init_particles(I32 capacity);
+void free_particles(void);
+void set_particle_limit(I32 limit);
+void emit_particles(Vec2 pos, I32 count, F32 speed, F32 lifetime, const U8 *colors, I32 color_count);
+void update_particles(F32 dt);
+void draw_particles(void);
+void sleep_seconds(F64 seconds);
+void init_frame_pacer(Pacer_Mode mode);
+void set_pacer_mode(Pacer_Mode mode);
+void pace_frame(void);
+bool is_static_frame(void);
+bool wait_while_idle(void);
+bool input_activity(void);
+void present_frame(void);
+void poll_input(void);
+void note_input_poll(F64 time);
+void note_present(F64 time);
+void plan_low_latency_start(F64 frame_start);
+void update_player_movement(F32 dt);
+void record_frame_time(F64 frame_start);
+I32  frame_histogram_bucket(U32 us);
+U64  frame_histogram_lower(I32 bucket);
+void histogram_add(Time_Histogram *histogram, F32 ms);
+F32  histogram_percentile(const Time_Histogram *histogram, F64 percentile);
+void draw_frame_stats(int x, int y);
+void save_frame_stats(const char *file_name);
+void record_telemetry(void);
+void add_telemetry_frame(Telemetry_Window *window);
+void end_telemetry_window(Telemetry_Window *window, const char *kind, const char *end);
+void flush_telemetry(void);
+void finish_telemetry(void);
+bool key_down(int key);
+bool key_pressed(int key);
+Vec2 steer_autopilot(void);
+void update_autopilot(void);
+void start_stress_test(void);
+void update_stress_test(void);
+void record_stress_frame(F32 frame_ms, F32 update_ms, F32 draw_ms);
+void save_stress_report(const char *file_name);
+U32  render_graph_draw_calls(void);
+void record_flight_frame(F64 frame_start);
+F64  end_flight_section(Flight_Section section, F64 start);
+void dump_flight_recorder(const char *file_name);
+void play_sound(Sound sound);
+void *tracked_malloc(size_t size);
+void *tracked_calloc(size_t count, size_t size);
+void *tracked_realloc(void *ptr, size_t size);
+void tracked_free(void *ptr);
+Alloc_Tag set_alloc_tag(Alloc_Tag tag);
+void end_alloc_frame(void);
+void draw_memory_stats(int x, int y);
+void report_allocations(void);
+void start_trace(const char *file_name);
+void stop_trace(void);
+void flush_trace(void);
+void update_tracer(void);
+I32  trace_begin(const char *name);
+void trace_end(I32 zone);
+void build_render_graph(void);
+void add_render_pass(Render_Pass_Id id, U32 reads, U32 writes, Render_Target target, bool palette, void (*execute)(void));
+void cull_render_graph(void);
+void execute_render_graph(void);
+void load_render_resources(void);
+void unload_render_resources(void);
+void install_draw_call_counter(void);
+void uninstall_draw_call_counter(void);
+void flush_render_batch(void);
+void init_gpu_timers(void);
+void unload_gpu_timers(void);
+void read_gpu_timers(void);
+void begin_gpu_timer(Render_Pass_Id group);
+void end_gpu_timer(void);
+void load_post_process(void);
+void unload_post_process(void);
+void resize_bloom_pyramid(void);
+void render_bloom(void);
+void begin_post_composite(void);
+void end_post_composite(void);
+void resize_light_buffer(void);
+void draw_light(Vec2 center, F32 radius, Color color);
+void draw_light_beam(Vec2 from, Vec2 to, F32 width, Color color);
+void render_lights(void);
+void stamp_decal(Decal decal);
+void bake_decals(void);
+void push_sprite(Clip_Frame frame, Palette_Row palette, Vec2 pos, Flip_Texture flip, Color tint);
+Anim_State start_clip(Clip_Id clip);
+void play_clip(Anim_State *anim, Clip_Id clip);
+void tick_animation(Anim_State *anim, U32 ticks);
+void update_animations(F32 dt);
+Clip_Frame clip_frame(Anim_State anim);
+void sort_draw_list(void);
+void draw_sprite_list(void);
+void push_bar(Vec2 pos, F32 fill, Color color);
+void collect_actor_bars(void);
+void draw_bars(void);
+void load_ray_shader(void);
+void draw_spell_ray(Spell_Kind spell, Vec2 from, Vec2 to);
 
 #endif // RAYLIB_GAME_H
\ No newline at end of file
@@ -0,0 +1,150 @@
+/*******************************************************************************************
+*
+*   Render benchmark
+*
+*   Draws the gameplay scene through the game's own render graph in a hidden window, with
+*   BENCH_SPRITE_COUNTS enemies and the spell ray off and on, and reports the frame times:
+*       sprites  rays  avg ms  p99 ms  max ms  draws  verts
+*
+*   Every frame is drawn into the world target and the backbuffer but never swapped, and ends
+*   on glFinish(), so the time covers the CPU side and the GPU finishing the frame.
+*
+*   glFinish() and the draw counts come from raylib's glad loader, so it only builds on desktop
+*   with the glad hooks, against a static raylib:
+*       make render_bench GLAD_HOOKS=TRUE       build.bat bench
+*
+*   Run from src/, like the game, it loads the same resources:
+*       render_bench [frames]
+*
+*   Headless Linux, on Mesa's software rasterizer (raylib logs "GL: Renderer:" on init):
+*       xvfb-run -a env LIBGL_ALWAYS_SOFTWARE=1 GALLIUM_DRIVER=llvmpipe ./render_bench
+*
+*   NOTE: Includes raylib_game.c with GAME_NO_MAIN, the scene is the game's state set up by hand
+*
+********************************************************************************************/
+
+#if !defined(PLATFORM_DESKTOP) || !defined(USE_GLAD_HOOKS)
+    #error "render_bench waits on glFinish() from raylib's glad loader, build it with -DPLATFORM_DESKTOP -DUSE_GLAD_HOOKS (make GLAD_HOOKS=TRUE) against a static raylib"
+#endif
+#define GAME_NO_MAIN
+#include "raylib_game.c"
+
+#define BENCH_FRAMES 300
+#define BENCH_WARMUP_FRAMES 30              // Not measured, lets textures and shaders settle
+#define BENCH_FRAME_DT (1.0f/60.0f)         // Animations advance as if the game ran at 60 fps
+#define BENCH_SEED 1
+
+static const I32 BENCH_SPRITE_COUNTS[] = { 100, 1000, 10000 };
+
+#define BENCH_SPRITE_COUNT_COUNT (I32)(sizeof(BENCH_SPRITE_COUNTS)/sizeof(BENCH_SPRITE_COUNTS[0]))
+
+typedef struct Bench_Result {
+    I32  sprites;
+    bool rays;
+    Time_Histogram times;
+    U32  draw_calls;        // Of the last frame, every frame draws the same scene
+    U32  vertices;
+} Bench_Result;
+
+// Same state as a gameplay frame: enemies spread over the visible part of the map, every other one
+// damaged so it has a health bar, and the death ray cast across the screen when rays are on
+static void setup_bench_scene(I32 sprites, bool rays)
+{
+    init_gameplay();
+    arrsetlen(enemies, 0);
+    current_screen = SCREEN_GAMEPLAY;
+
+    camera.target = player.pos;
+    camera.offset = (Vec2){ screenWidth/2 - TILE_SIZE/2, screenHeight/2 - TILE_SIZE/2 };
+    camera.zoom = 1.0f;
+
+    SetRandomSeed(BENCH_SEED);
+    for (I32 i = 0; i < sprites; i++) {
+        Enemy enemy = {
+            .id = i,
+            .alive = true,
+            .pos = (Vec2){
+                player.pos.x - screenWidth/2 + GetRandomValue(0, screenWidth - TILE_SIZE),
+                player.pos.y - screenHeight/2 + GetRandomValue(0, screenHeight - TILE_SIZE) },
+            .speed = TILE_SIZE*1.5f,
+            .health = (i%2 == 0) ? 100.0f : 50.0f,
+            .max_health = 100.0f,
+            .flip_texture = (i%3 == 0) ? FLIP_X : NO_FLIP,
+            .anim = start_clip(CLIP_ENEMY_0_WALK + i%4),
+        };
+        arrput(enemies, enemy);
+    }
+
+    apprentice.pos = Vector2Add(player.pos, (Vec2){ 240, 320 });
+    player.ray_anchor = Vector2Add(SPRITE_CENTER(player.pos), (Vec2){ 0, 24 });
+    apprentice.ray_anchor = Vector2Add(SPRITE_CENTER(apprentice.pos), (Vec2){ 0, 24 });
+    player.active_spell = rays ? DEATH_RAY : NO_SPELL;
+    player.is_casting = rays;
+}
+
+static Bench_Result run_bench(I32 sprites, bool rays, I32 frames)
+{
+    Bench_Result result = { .sprites = sprites, .rays = rays };
+    setup_bench_scene(sprites, rays);
+
+    for (I32 i = 0; i < BENCH_WARMUP_FRAMES + frames; i++) {
+        update_animations(BENCH_FRAME_DT);
+
+        F64 start = GetTime();
+        build_render_graph();
+        execute_render_graph();
+        glad_glFinish();
+        F32 ms = (F32)((GetTime() - start)*1000.0);
+
+        if (i >= BENCH_WARMUP_FRAMES) histogram_add(&result.times, ms);
+    }
+
+    for (I32 i = 0; i < PASS_COUNT; i++) {
+        result.draw_calls += render_graph.stats[i].draw_calls;
+        result.vertices += render_graph.stats[i].vertices;
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    I32 frames = BENCH_FRAMES;
+    if (argc > 1) frames = atoi(argv[1]);
+    if (frames <= 0) {
+        printf("Usage: render_bench [frames]\n");
+        return 1;
+    }
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(screenWidth, screenHeight, "The Apprentice - render bench");
+    load_render_resources();
+
+    Bench_Result results[BENCH_SPRITE_COUNT_COUNT*2] = { 0 };
+    I32 result_count = 0;
+    for (I32 i = 0; i < BENCH_SPRITE_COUNT_COUNT; i++) {
+        results[result_count++] = run_bench(BENCH_SPRITE_COUNTS[i], false, frames);
+        results[result_count++] = run_bench(BENCH_SPRITE_COUNTS[i], true, frames);
+    }
+
+    printf("\n%i frames per configuration, %ix%i\n", frames, screenWidth, screenHeight);
+    printf("sprites  rays  avg ms  p99 ms  max ms  draws   verts\n");
+    for (I32 i = 0; i < result_count; i++) {
+        Bench_Result *result = &results[i];
+        printf("%7i  %4s  %6.2f  %6.2f  %6.2f  %5u  %6u\n", result->sprites, result->rays ? "on" : "off",
+            result->times.total_ms/result->times.count, histogram_percentile(&result->times, 99.0),
+            result->times.max_ms, result->draw_calls, result->vertices);
+    }
+
+    arrfree(enemies);
+    arrfree(dying_enemies);
+    arrfree(bars);
+    arrfree(draw_list.sprites);
+    arrfree(draw_list.keys);
+    arrfree(draw_list.records);
+    arrfree(draw_list.scratch);
+    arrfree(draw_list.prev_order);
+    unload_render_resources();
+    CloseWindow();
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#ifndef SHADERS_H
+#define SHADERS_H
+
+//----------------------------------------------------------------------------------
+// Fragment shaders embedded as code, all of them use raylib's default vertex shader
+// NOTE: SHADER_HEADER hides the differences between GLSL 330 and GLSL 100 (GLES2/WebGL)
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_DESKTOP)
+    #define SHADER_HEADER \
+        "#version 330\n" \
+        "#define IN in\n" \
+        "#define TEXTURE texture\n" \
+        "#define FRAG_COLOR finalColor\n" \
+        "out vec4 finalColor;\n"
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define SHADER_HEADER \
+        "#version 100\n" \
+        "precision mediump float;\n" \
+        "#define IN varying\n" \
+        "#define TEXTURE texture2D\n" \
+        "#define FRAG_COLOR gl_FragColor\n"
+#endif
+
+// Mana Ray / Death Ray: activation ring, end caps and two-layer beam as signed distance shapes.
+// The quad is drawn with texcoords 0..1 over the world rect given in `quad`.
+static const char *RAY_FRAGMENT_SHADER = SHADER_HEADER
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform vec4 quad;\n"              // World rect covered by the quad (x, y, width, height)
+    "uniform vec2 anchor_a;\n"          // Player ray anchor
+    "uniform vec2 anchor_b;\n"          // Apprentice ray anchor, centre of the activation ring
+    "uniform float ring_radius;\n"
+    "uniform float pixel_size;\n"       // World units per target pixel, keeps edges one pixel wide
+    "uniform vec4 outer_color;\n"
+    "uniform vec4 inner_color;\n"
+    "float sd_capsule(vec2 p, vec2 a, vec2 b, float r) {\n"
+    "    vec2 pa = p - a;\n"
+    "    vec2 ba = b - a;\n"
+    "    float h = clamp(dot(pa, ba)/max(dot(ba, ba), 0.0001), 0.0, 1.0);\n"
+    "    return length(pa - ba*h) - r;\n"
+    "}\n"
+    "void main() {\n"
+    "    vec2 p = quad.xy + fragTexCoord*quad.zw;\n"
+    "    float ring  = abs(length(p - anchor_b) - ring_radius) - 2.0;\n"
+    "    float outer = min(ring, sd_capsule(p, anchor_a, anchor_b, 8.0));\n"
+    "    float inner = sd_capsule(p, anchor_a, anchor_b, 5.0);\n"
+    "    float outer_coverage = clamp(0.5 - outer/pixel_size, 0.0, 1.0);\n"
+    "    float inner_coverage = clamp(0.5 - inner/pixel_size, 0.0, 1.0);\n"
+    "    if (outer_coverage <= 0.0) discard;\n"
+    "    vec4 color = mix(outer_color, inner_color, inner_coverage);\n"
+    "    FRAG_COLOR = vec4(color.rgb, color.a*outer_coverage)*fragColor;\n"
+    "}\n";
+
+// Bloom bright pass: keeps what is above the threshold, with a soft knee
+static const char *BLOOM_THRESHOLD_FRAGMENT_SHADER = SHADER_HEADER
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform float threshold;\n"
+    "void main() {\n"
+    "    vec4 color = TEXTURE(texture0, fragTexCoord);\n"
+    "    float brightness = max(color.r, max(color.g, color.b));\n"
+    "    float contribution = smoothstep(threshold, threshold + 0.2, brightness);\n"
+    "    FRAG_COLOR = vec4(color.rgb*contribution*color.a, 1.0);\n"
+    "}\n";
+
+// Separable 9 tap gaussian, folded into 5 bilinear samples. `direction` is one texel along the blur axis
+static const char *BLUR_FRAGMENT_SHADER = SHADER_HEADER
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec2 direction;\n"
+    "void main() {\n"
+    "    vec3 color = TEXTURE(texture0, fragTexCoord).rgb*0.2270270270;\n"
+    "    color += TEXTURE(texture0, fragTexCoord + direction*1.3846153846).rgb*0.3162162162;\n"
+    "    color += TEXTURE(texture0, fragTexCoord - direction*1.3846153846).rgb*0.3162162162;\n"
+    "    color += TEXTURE(texture0, fragTexCoord + direction*3.2307692308).rgb*0.0702702703;\n"
+    "    color += TEXTURE(texture0, fragTexCoord - direction*3.2307692308).rgb*0.0702702703;\n"
+    "    FRAG_COLOR = vec4(color, 1.0);\n"
+    "}\n";
+
+// Final composite of the world target: bloom, vignette and palette quantization, each one toggled by a uniform
+static const char *POST_COMPOSITE_FRAGMENT_SHADER = SHADER_HEADER
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform sampler2D bloom;\n"
+    "uniform float bloom_intensity;\n"     // 0 disables bloom
+    "uniform float vignette_strength;\n"   // 0 disables the vignette
+    "uniform int palette_enabled;\n"
+    "uniform vec3 palette[8];\n"
+    "void main() {\n"
+    "    vec4 color = TEXTURE(texture0, fragTexCoord);\n"
+    "    color.rgb += TEXTURE(bloom, fragTexCoord).rgb*bloom_intensity;\n"
+    "    float edge = length(fragTexCoord - vec2(0.5))*1.4142;\n"
+    "    color.rgb *= 1.0 - vignette_strength*smoothstep(0.5, 1.0, edge);\n"
+    "    if (palette_enabled != 0) {\n"
+    "        vec3 nearest = palette[0];\n"
+    "        float best = 1000.0;\n"
+    "        for (int i = 0; i < 8; i++) {\n"
+    "            vec3 d = color.rgb - palette[i];\n"
+    "            float dist = dot(d, d);\n"
+    "            if (dist < best) {\n"
+    "                best = dist;\n"
+    "                nearest = palette[i];\n"
+    "            }\n"
+    "        }\n"
+    "        color.rgb = nearest;\n"
+    "    }\n"
+    "    FRAG_COLOR = color*fragColor;\n"
+    "}\n";
+
+// Palette lookup for the R8 atlas and background: red holds a palette index and the integer
+// part of the v texcoord selects the LUT row, so one batch can mix palette variants.
+// Alpha of the sampled texel is kept, RGBA textures drawn by mistake stay transparent where they should.
+static const char *PALETTE_FRAGMENT_SHADER = SHADER_HEADER
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"
+    "precision highp float;\n"         // v carries the row on top of the texel position
+    "#endif\n"
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform sampler2D palette;\n"
+    "uniform vec2 palette_size;\n"      // LUT size in texels (indices, rows)
+    "uniform vec4 colDiffuse;\n"
+    "void main() {\n"
+    "    float row = floor(fragTexCoord.y);\n"
+    "    vec4 texel = TEXTURE(texture0, vec2(fragTexCoord.x, fragTexCoord.y - row));\n"
+    "    float index = floor(texel.r*255.0 + 0.5);\n"
+    "    vec4 color = TEXTURE(palette, (vec2(index, row) + 0.5)/palette_size);\n"
+    "    FRAG_COLOR = vec4(color.rgb, color.a*texel.a)*fragColor*colDiffuse;\n"
+    "}\n";
+
+#endif // SHADERS_H